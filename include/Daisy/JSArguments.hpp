@@ -0,0 +1,114 @@
+/**
+ * Copyright (c) 2015 by Kota Iguchi. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _DAISY_JSARGUMENTS_HPP_
+#define _DAISY_JSARGUMENTS_HPP_
+
+#include "Daisy/detail/JSBase.hpp"
+#include "Daisy/JSValue.hpp"
+#include "jerry.h"
+#include <iterator>
+#include <vector>
+
+namespace Daisy {
+
+	/*!
+	 * Read-only view over the arguments the engine passes to a native
+	 * callback. Nothing is copied when the view is created; an argument
+	 * is wrapped in a JSValue only when it is accessed. The view is only
+	 * valid for the duration of the callback.
+	 */
+	class DAISY_EXPORT JSArguments final {
+	public:
+		class const_iterator {
+		public:
+			using iterator_category = std::input_iterator_tag;
+			using value_type        = JSValue;
+			using difference_type   = std::ptrdiff_t;
+			using pointer           = void;
+			using reference         = JSValue;
+
+			const_iterator(const JSArguments* js_arguments, const std::size_t index) DAISY_NOEXCEPT
+				: js_arguments__(js_arguments)
+				, index__(index) {
+			}
+
+			JSValue operator*() const DAISY_NOEXCEPT {
+				return (*js_arguments__)[index__];
+			}
+
+			const_iterator& operator++() DAISY_NOEXCEPT {
+				++index__;
+				return *this;
+			}
+
+			const_iterator operator++(int) DAISY_NOEXCEPT {
+				const auto result = *this;
+				++index__;
+				return result;
+			}
+
+			bool operator==(const const_iterator& rhs) const DAISY_NOEXCEPT {
+				return index__ == rhs.index__;
+			}
+
+			bool operator!=(const const_iterator& rhs) const DAISY_NOEXCEPT {
+				return index__ != rhs.index__;
+			}
+
+		private:
+			const JSArguments* js_arguments__;
+			std::size_t        index__;
+		};
+
+		JSArguments(const JSContext& js_context, const jerry_api_value_t js_api_arguments[], const jerry_api_length_t argument_count) DAISY_NOEXCEPT;
+
+		std::size_t size() const DAISY_NOEXCEPT {
+			return argument_count__;
+		}
+
+		bool empty() const DAISY_NOEXCEPT {
+			return argument_count__ == 0;
+		}
+
+		// Like JavaScript, reading past the last argument yields undefined.
+		JSValue operator[](const std::size_t index) const DAISY_NOEXCEPT;
+
+		// The engine value of an argument, borrowed for the duration of the
+		// callback; undefined past the last argument.
+		const jerry_api_value_t& get_api_value(const std::size_t index) const DAISY_NOEXCEPT;
+
+		JSContext get_context() const DAISY_NOEXCEPT {
+			return js_context__;
+		}
+
+		const_iterator begin() const DAISY_NOEXCEPT {
+			return const_iterator(this, 0);
+		}
+
+		const_iterator end() const DAISY_NOEXCEPT {
+			return const_iterator(this, argument_count__);
+		}
+
+		// Wrap every argument, for code that needs to keep them past the callback.
+		explicit operator std::vector<JSValue>() const DAISY_NOEXCEPT;
+
+	private:
+		JSArguments(const JSArguments&)            = delete;
+		JSArguments& operator=(const JSArguments&) = delete;
+
+		// Prevent heap based objects.
+		void* operator new(std::size_t)     = delete; // #1: To prevent allocation of scalar objects
+		void* operator new [] (std::size_t) = delete; // #2: To prevent allocation of array of objects
+
+		JSContext                js_context__;
+		const jerry_api_value_t* js_api_arguments__;
+		const std::size_t        argument_count__;
+	};
+
+} // namespace Daisy {
+
+#endif // _DAISY_JSARGUMENTS_HPP_
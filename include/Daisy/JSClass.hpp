@@ -10,18 +10,22 @@
 #include "Daisy/detail/JSBase.hpp"
 #include "jerry.h"
 #include <functional>
+#include <memory>
 #include <vector>
 #include <unordered_map>
 
 namespace Daisy {
 
 	class JSContext;
+	class JSContextGroup;
 	class JSValue;
 	class JSObject;
+	class JSArguments;
 	
-	typedef std::function<JSValue(JSObject, JSObject, const std::vector<JSValue>&)> JSObjectCallAsFunctionCallback;
+	typedef std::function<JSValue(JSObject, JSObject, const JSArguments&)> JSObjectCallAsFunctionCallback;
 	typedef std::function<void(const JSContext&, JSObject, const std::vector<JSValue>&)> JSObjectCallAsConstructorCallback;
 	typedef std::function<void(const std::uintptr_t&)> JSObjectFinalizeCallback;
+	typedef void (*JSObjectFinalizeFunction)(const std::uintptr_t native_ptr);
 
 	class DAISY_EXPORT JSClass {
 	public:
@@ -35,11 +39,18 @@ namespace Daisy {
 		
 		void AddFunctionProperty(const std::string& name, JSObjectCallAsFunctionCallback callback);
 
+		// Functions that objects of the class expose, by name.
+		virtual std::unordered_map<std::string, JSObjectCallAsFunctionCallback> GetFunctionProperties() const;
+
 		virtual JSObject JSObjectMakeFunctionWithCallback(const JSContext& js_context, const std::string& name, JSObjectCallAsFunctionCallback) const;
 		virtual void ConstructorInitializeCallback(const JSContext& js_context, JSObject& this_object) const;
 		virtual JSObjectCallAsConstructorCallback getCallAsConstructorCallback() const;
 
 	protected:
+		// The prototype and its function objects are built once per engine
+		// and shared by every object of the class; call this whenever the
+		// functions of the class change so that they are built again.
+		void ResetPrototype() DAISY_NOEXCEPT;
 
 		// Prevent heap based objects.
 		void* operator new(std::size_t)     = delete; // #1: To prevent allocation of scalar objects
@@ -58,7 +69,17 @@ namespace Daisy {
 #pragma warning(push)
 #pragma warning(disable: 4251)
 		std::unordered_map<std::string, JSObjectCallAsFunctionCallback> prototype_functions_map__;
+
+		// Shared by copies of the class; identifies its cached prototype.
+		std::shared_ptr<char> prototype_id__;
 #pragma warning(pop)
+
+	private:
+		friend JSContextGroup;
+
+		// Cached prototypes hold engine references, so they have to be
+		// released before the engine is cleaned up.
+		static void ClearPrototypeCache() DAISY_NOEXCEPT;
 	};
 	
 } // namespace Daisy {
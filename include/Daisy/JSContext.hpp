@@ -9,6 +9,7 @@
 
 #include "Daisy/detail/JSBase.hpp"
 #include "Daisy/JSContextGroup.hpp"
+#include <vector>
 
 namespace Daisy {
 
@@ -16,8 +17,13 @@ namespace Daisy {
 	class JSNumber;
 	class JSBoolean;
 	class JSString;
+	class JSPropertyKey;
 	class JSObject;
 	class JSClass;
+	class JSScript;
+	namespace detail {
+		class JSContextScope;
+	}
 
 	class DAISY_EXPORT JSContext {
 	public:
@@ -36,16 +42,68 @@ namespace Daisy {
 		JSNumber CreateNumber(const std::uint32_t& number) const DAISY_NOEXCEPT;
 		JSBoolean CreateBoolean(const bool& value) const DAISY_NOEXCEPT;
 		JSString CreateString(const std::string& value) const DAISY_NOEXCEPT;
+		JSPropertyKey CreatePropertyKey(const std::string& name) const DAISY_NOEXCEPT;
 		JSObject CreateObject() const DAISY_NOEXCEPT;
 		JSObject CreateObject(const JSClass&) const DAISY_NOEXCEPT;
 
+		// Create a JS array of the elements in one engine call. Elements
+		// may be of any type that JSValueConverter converts.
+		template<typename T>
+		JSObject CreateArray(const std::vector<T>& values) const DAISY_NOEXCEPT;
+
+		// Create a JS value of a C++ value with JSValueConverter<T>;
+		// nested vectors, tuples and maps are built in one pass.
+		template<typename T>
+		JSValue CreateValue(const T& value) const DAISY_NOEXCEPT;
+
 		JSValue JSEvaluateScript(const std::string& script) const;
+		JSValue JSEvaluateScript(const JSScript& script) const;
+
+		// Run a snapshot created by JSScript::CreateSnapshot. The file
+		// version maps the snapshot into memory instead of reading it.
+		JSValue EvaluateSnapshot(const std::uint8_t* snapshot, const std::size_t snapshot_size) const;
+		JSValue EvaluateSnapshot(const std::string& snapshot_path) const;
+
+		// Parse the source once; the returned script can be run many times.
+		JSScript CreateScript(const std::string& source) const;
+
+		// When enabled, compiled scripts are cached by source so that
+		// evaluating the same source again skips the parser.
+		void set_script_cache_enabled(const bool enabled) DAISY_NOEXCEPT;
+		bool get_script_cache_enabled() const DAISY_NOEXCEPT;
+
+		// The cache keeps at most capacity scripts (64 by default) and
+		// evicts the least recently used one, whose code is then freed.
+		void set_script_cache_capacity(const std::size_t capacity) DAISY_NOEXCEPT;
+		std::size_t get_script_cache_capacity() const DAISY_NOEXCEPT;
+		std::size_t get_script_cache_size() const DAISY_NOEXCEPT;
+		std::size_t get_script_cache_hits() const DAISY_NOEXCEPT;
+		std::size_t get_script_cache_misses() const DAISY_NOEXCEPT;
+
+		// Run the garbage collector now.
+		void JSGarbageCollect() const DAISY_NOEXCEPT;
+
+		// When enabled, native private data of collected objects is
+		// queued and finalized by DrainFinalizationQueue instead of in
+		// the middle of whichever call triggered the collection.
+		void set_deferred_finalization_enabled(const bool enabled) DAISY_NOEXCEPT;
+		bool get_deferred_finalization_enabled() const DAISY_NOEXCEPT;
+		std::size_t get_pending_finalization_count() const DAISY_NOEXCEPT;
+
+		// Finalize up to max_count queued private data and return how
+		// many were finalized. Call it where latency does not matter.
+		std::size_t DrainFinalizationQueue(const std::size_t max_count = SIZE_MAX) const;
 
 	private:
     	friend class JSContextGroup;
+		friend class detail::JSContextScope;
     
 		JSContext() DAISY_NOEXCEPT;
 
+		// Compiled scripts are owned by the engine, so the cache has to
+		// be dropped when the engine is cleaned up.
+		static void ClearScriptCache() DAISY_NOEXCEPT;
+
 		// Prevent heap based objects.
 		void* operator new(std::size_t)     = delete; // #1: To prevent allocation of scalar objects
 		void* operator new [] (std::size_t) = delete; // #2: To prevent allocation of array of objects
@@ -0,0 +1,109 @@
+/**
+ * Copyright (c) 2015 by Kota Iguchi. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _DAISY_JSCONTEXTEXECUTOR_HPP_
+#define _DAISY_JSCONTEXTEXECUTOR_HPP_
+
+#include "Daisy/detail/JSBase.hpp"
+#include "Daisy/detail/JSJobQueue.hpp"
+#include "Daisy/JSContext.hpp"
+#include <cstdint>
+#include <future>
+#include <type_traits>
+
+namespace Daisy {
+
+	/*!
+	 * Runs work submitted from any thread on the thread that owns a
+	 * JSContext. Post queues a job without taking a lock and returns a
+	 * future for its result; the engine thread runs queued jobs in
+	 * batches with RunPending. Jobs should return plain C++ values, since
+	 * JS values must not leave the engine thread.
+	 */
+	class DAISY_EXPORT JSContextExecutor final {
+	public:
+		explicit JSContextExecutor(const JSContext& js_context) DAISY_NOEXCEPT;
+		~JSContextExecutor() DAISY_NOEXCEPT;
+
+		// Queue f to be called with the context; may be called from any thread.
+		template<typename F>
+		std::future<typename std::result_of<F(JSContext&)>::type> Post(F&& f);
+
+		// Like Post, for jobs whose result is not needed. Skipping the
+		// future saves its shared state; an exception thrown by the job
+		// propagates out of RunPending.
+		template<typename F>
+		void Dispatch(F&& f);
+
+		// Run up to max_count queued jobs in the order they were posted and
+		// return how many were run. Call only from the engine thread.
+		std::size_t RunPending(const std::size_t max_count = SIZE_MAX);
+
+	private:
+		JSContextExecutor(const JSContextExecutor&)            = delete;
+		JSContextExecutor& operator=(const JSContextExecutor&) = delete;
+
+		// Prevent heap based objects.
+		void* operator new(std::size_t)     = delete; // #1: To prevent allocation of scalar objects
+		void* operator new [] (std::size_t) = delete; // #2: To prevent allocation of array of objects
+
+		template<typename R>
+		class JSPackagedJob final : public detail::JSJob {
+		public:
+			template<typename F>
+			explicit JSPackagedJob(F&& f)
+				: task__(std::forward<F>(f)) {
+			}
+
+			std::future<R> get_future() {
+				return task__.get_future();
+			}
+
+			// Exceptions thrown by the job are stored in its future.
+			virtual void Run(JSContext& js_context) override {
+				task__(js_context);
+			}
+
+		private:
+			std::packaged_task<R(JSContext&)> task__;
+		};
+
+		template<typename F>
+		class JSFunctionJob final : public detail::JSJob {
+		public:
+			explicit JSFunctionJob(F&& f)
+				: function__(std::forward<F>(f)) {
+			}
+
+			virtual void Run(JSContext& js_context) override {
+				function__(js_context);
+			}
+
+		private:
+			typename std::decay<F>::type function__;
+		};
+
+		JSContext          js_context__;
+		detail::JSJobQueue js_job_queue__;
+	};
+
+	template<typename F>
+	std::future<typename std::result_of<F(JSContext&)>::type> JSContextExecutor::Post(F&& f) {
+		typedef typename std::result_of<F(JSContext&)>::type result_type;
+		const auto js_job = new JSPackagedJob<result_type>(std::forward<F>(f));
+		auto future = js_job->get_future();
+		js_job_queue__.Push(js_job);
+		return future;
+	}
+
+	template<typename F>
+	void JSContextExecutor::Dispatch(F&& f) {
+		js_job_queue__.Push(new JSFunctionJob<F>(std::forward<F>(f)));
+	}
+
+} // namespace Daisy {
+
+#endif // _DAISY_JSCONTEXTEXECUTOR_HPP_
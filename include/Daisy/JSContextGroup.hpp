@@ -16,6 +16,21 @@ namespace Daisy {
 	class DAISY_EXPORT JSContextGroup {
 	public:
 		JSContextGroup() DAISY_NOEXCEPT;
+
+		// Start the engine with a heap of heap_size bytes, or of the default
+		// size if it is 0. The size only applies if no other group keeps the
+		// engine running on this thread; it is rounded down to the heap chunk
+		// size and capped at the maximum of the build (2 ^ Daisy_HEAP_OFFSET_LOG).
+		explicit JSContextGroup(const std::size_t heap_size) DAISY_NOEXCEPT;
+
+		// With Daisy_ENABLE_CONTEXTS each thread runs one engine with a heap
+		// of its own. A group owns the engine of the thread that created it,
+		// so a second group created on that thread while the first one is
+		// alive is invalid: it holds no engine and must not create contexts.
+		// Copies of a group share its engine. Without contexts every group
+		// is valid and all of them share the one engine.
+		bool IsValid() const DAISY_NOEXCEPT;
+
 		JSContext CreateContext() const DAISY_NOEXCEPT;
 		
 		~JSContextGroup()                         DAISY_NOEXCEPT;
@@ -39,8 +54,9 @@ namespace Daisy {
 #define DAISY_JSCONTEXTGROUP_LOCK_GUARD
 #endif  // DAISY_THREAD_SAFE
 
-		void EnsureJerryInit();
-		static std::size_t retainCount__;
+		bool EnsureJerryInit(const std::size_t heap_size);
+		static DAISY_THREAD_LOCAL std::size_t retainCount__;
+		bool valid__;
 	};
 
   inline
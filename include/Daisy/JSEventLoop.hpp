@@ -0,0 +1,122 @@
+/**
+ * Copyright (c) 2015 by Kota Iguchi. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _DAISY_JSEVENTLOOP_HPP_
+#define _DAISY_JSEVENTLOOP_HPP_
+
+#include "Daisy/detail/JSBase.hpp"
+#include "Daisy/JSContext.hpp"
+#include "Daisy/JSObject.hpp"
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <vector>
+
+namespace Daisy {
+
+	typedef std::function<void(JSContext&)> JSEventLoopTask;
+
+	/*!
+	 * Timers and microtasks for a JSContext, run on the calling thread.
+	 * Every timer callback is a macrotask, and the microtask queue is
+	 * drained after each one. Timers are kept in a hierarchical wheel of
+	 * millisecond ticks, so scheduling and cancelling are O(1).
+	 */
+	class DAISY_EXPORT JSEventLoop final {
+	public:
+		typedef std::chrono::steady_clock clock;
+
+		explicit JSEventLoop(const JSContext& js_context) DAISY_NOEXCEPT;
+		~JSEventLoop() DAISY_NOEXCEPT;
+
+		// Schedule a task or a JS function; the returned id is never 0.
+		std::uint32_t SetTimeout(JSEventLoopTask task, const std::chrono::milliseconds& delay);
+		std::uint32_t SetTimeout(JSObject function, const std::chrono::milliseconds& delay, std::vector<JSValue> arguments = {});
+		std::uint32_t SetInterval(JSEventLoopTask task, const std::chrono::milliseconds& interval);
+		std::uint32_t SetInterval(JSObject function, const std::chrono::milliseconds& interval, std::vector<JSValue> arguments = {});
+
+		// Cancel a timeout or an interval; unknown ids are ignored.
+		void ClearTimer(const std::uint32_t timer_id) DAISY_NOEXCEPT;
+
+		void QueueMicrotask(JSEventLoopTask task);
+		void QueueMicrotask(JSObject function);
+
+		// Define setTimeout, setInterval, clearTimeout, clearInterval and
+		// queueMicrotask on the global object, bound to this loop.
+		void InstallGlobalFunctions();
+
+		// Run due timers and microtasks without waiting, and return the
+		// number of tasks run.
+		std::size_t RunPending();
+
+		// Run timers and microtasks as they become due, sleeping in
+		// between, until the deadline passes or there is nothing left to
+		// run. Return the number of tasks run.
+		std::size_t RunUntil(const clock::time_point& deadline);
+
+		bool HasPendingTasks() const DAISY_NOEXCEPT {
+			return active_timer_count__ > 0 || !microtasks__.empty();
+		}
+
+	private:
+		JSEventLoop(const JSEventLoop&)            = delete;
+		JSEventLoop& operator=(const JSEventLoop&) = delete;
+
+		// Prevent heap based objects.
+		void* operator new(std::size_t)     = delete; // #1: To prevent allocation of scalar objects
+		void* operator new [] (std::size_t) = delete; // #2: To prevent allocation of array of objects
+
+		static const std::uint32_t wheel_levels     = 4;
+		static const std::uint32_t wheel_slot_bits  = 6;
+		static const std::uint32_t wheel_slot_count = 1 << wheel_slot_bits;
+
+		// Timer ids carry the index of the entry and a generation, so a
+		// stale id does not cancel a timer that reused the entry.
+		static const std::uint32_t timer_index_bits = 20;
+		static const std::uint32_t timer_index_mask = (1 << timer_index_bits) - 1;
+
+		struct JSTimer {
+			JSEventLoopTask task;
+			std::uint64_t   expiry_tick { 0 };
+			std::uint64_t   interval { 0 };
+			std::uint32_t   id { 0 };
+			bool            active { false };
+		};
+
+		typedef std::vector<std::uint32_t> JSTimerSlot;
+
+		std::uint64_t GetTick(const clock::time_point& time_point) const DAISY_NOEXCEPT;
+		std::uint32_t AddTimer(JSEventLoopTask task, const std::uint64_t& delay, const std::uint64_t& interval);
+		void InsertTimer(const std::uint32_t timer_id);
+		void AdvanceTo(const std::uint64_t& tick);
+		std::uint64_t GetNextTimerTick() const DAISY_NOEXCEPT;
+		bool RunMacrotask();
+		std::size_t DrainMicrotasks();
+		JSEventLoopTask MakeFunctionTask(JSObject function, std::vector<JSValue> arguments) const;
+
+		// Silence 4251 on Windows since private member variables do not
+		// need to be exported from a DLL.
+#pragma warning(push)
+#pragma warning(disable: 4251)
+		JSContext                  js_context__;
+		JSObject                   js_global_object__;
+		clock::time_point          start_time__;
+		std::uint64_t              current_tick__ { 0 };
+		std::size_t                active_timer_count__ { 0 };
+		std::deque<JSTimer>        timers__;
+		std::vector<std::uint32_t> free_timers__;
+		std::array<std::array<JSTimerSlot, wheel_slot_count>, wheel_levels> wheel__;
+		std::deque<std::uint32_t>  due_timers__;
+		std::deque<JSEventLoopTask> microtasks__;
+		bool                       global_functions_installed__ { false };
+#pragma warning(pop)
+	};
+
+} // namespace Daisy {
+
+#endif // _DAISY_JSEVENTLOOP_HPP_
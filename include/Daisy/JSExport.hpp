@@ -5,12 +5,15 @@
 #include "Daisy/JSExportClass.hpp"
 #include "Daisy/JSContext.hpp"
 #include "Daisy/JSObject.hpp"
+#include "Daisy/JSArguments.hpp"
+#include "Daisy/detail/JSNativeFunction.hpp"
+#include <cassert>
 #include <mutex>
 
 namespace Daisy {
 
 	template<typename T>
-	using CallNamedFunctionCallback = std::function<JSValue(T&, const std::vector<JSValue>&, JSObject&)>;
+	using CallNamedFunctionCallback = std::function<JSValue(T&, const JSArguments&, JSObject&)>;
 
 	template<typename T>
 	class DAISY_EXPORT JSExport {
@@ -22,6 +25,14 @@ namespace Daisy {
 	protected:
 		static JSExportClass<T> js_class__;
 		static void AddFunctionProperty(const std::string& name, CallNamedFunctionCallback<T> callback);
+
+		// Bind a member function; arguments and the result are converted
+		// according to its signature. Called on an object that has no
+		// native peer, the function does nothing and returns undefined.
+		template<typename R, typename... Args>
+		static void AddFunction(const std::string& name, R (T::*method)(Args...));
+		template<typename R, typename... Args>
+		static void AddFunction(const std::string& name, R (T::*method)(Args...) const);
 		static void SetParent(const JSClass& js_class);
 		static void SetClassVersion(const std::uint32_t& class_version);
 	};
@@ -31,7 +42,7 @@ namespace Daisy {
 
 	template<typename T>
 	void JSExport<T>::AddFunctionProperty(const std::string& name, CallNamedFunctionCallback<T> callback) {
-		js_class__.AddFunctionProperty(name, [callback](JSObject function_object, JSObject this_object, const std::vector<JSValue>& arguments){
+		js_class__.AddFunctionProperty(name, [callback](JSObject function_object, JSObject this_object, const JSArguments& arguments){
 			auto t = reinterpret_cast<T*>(this_object.GetPrivate());
 			if (t) {
 				return callback(*t, arguments, this_object);
@@ -41,6 +52,30 @@ namespace Daisy {
 		});
 	}
 
+	template<typename T>
+	template<typename R, typename... Args>
+	void JSExport<T>::AddFunction(const std::string& name, R (T::*method)(Args...)) {
+		js_class__.AddFunctionProperty(name, [method](JSObject, JSObject this_object, const JSArguments& arguments) {
+			auto t = reinterpret_cast<T*>(this_object.GetPrivate());
+			if (t) {
+				return detail::CallNativeMethod<T, R, Args...>(*t, method, arguments);
+			}
+			return this_object.get_context().CreateUndefined();
+		});
+	}
+
+	template<typename T>
+	template<typename R, typename... Args>
+	void JSExport<T>::AddFunction(const std::string& name, R (T::*method)(Args...) const) {
+		js_class__.AddFunctionProperty(name, [method](JSObject, JSObject this_object, const JSArguments& arguments) {
+			auto t = reinterpret_cast<T*>(this_object.GetPrivate());
+			if (t) {
+				return detail::CallNativeMethod<T, R, Args...>(*t, method, arguments);
+			}
+			return this_object.get_context().CreateUndefined();
+		});
+	}
+
 	template<typename T>
 	JSExportClass<T> JSExport<T>::Class() {
 		static std::once_flag of;
@@ -70,7 +105,8 @@ namespace Daisy {
 		virtual void postCallAsConstructor(const JSContext&, const std::vector<JSValue>&) {}
 		
 		virtual JSObject get_object() DAISY_NOEXCEPT {
-			return JSObject::FindJSObjectFromPrivateData(js_context__, reinterpret_cast<std::uintptr_t>(this));
+			assert(js_api_object__ != nullptr);
+			return JSObject(js_context__, jerry_api_acquire_object(const_cast<jerry_api_object_t*>(js_api_object__)));
 		}
 
 		virtual JSContext get_context() {
@@ -82,6 +118,13 @@ namespace Daisy {
 		}
 	protected:
 		JSContext js_context__;
+
+	private:
+		template<typename T>
+		friend class JSExportClass;
+
+		// Not retained: the object owns this peer and outlives it.
+		const jerry_api_object_t* js_api_object__ { nullptr };
 	};
 } // namespace Daisy {
 
@@ -3,9 +3,19 @@
 
 #include "Daisy/JSClass.hpp"
 #include "Daisy/JSObject.hpp"
+#include <memory>
 
 namespace Daisy {
 
+	/*!
+	 * Allocator of the native objects of an exported class. Specialize it
+	 * to give a class its own allocator, such as JSSlabAllocator<T>.
+	 */
+	template<typename T>
+	struct JSExportAllocator {
+		typedef std::allocator<T> type;
+	};
+
 	template<typename T>
 	class DAISY_EXPORT JSExportClass final : public JSClass {
 	public:
@@ -23,22 +33,50 @@ namespace Daisy {
 
 		virtual void SetParent(const JSClass& js_class) {
 			js_class_parent__ = js_class;
+			ResetPrototype();
+		}
+
+		virtual std::unordered_map<std::string, JSObjectCallAsFunctionCallback> GetFunctionProperties() const override {
+			auto function_properties = js_class_parent__.GetFunctionProperties();
+			for (const auto& v : prototype_functions_map__) {
+				function_properties[v.first] = v.second;
+			}
+			return function_properties;
 		}
 
 	protected:
 		JSClass js_class_parent__;
 
-		JSObjectFinalizeCallback js_object_finalize_callback__ = [](const std::uintptr_t& native_ptr) {
-			delete reinterpret_cast<T*>(native_ptr);
-		};
 		JSObjectCallAsConstructorCallback js_object_constructor_callback__ = [](const JSContext& js_context, JSObject this_object, const std::vector<JSValue>& arguments) {
-			auto native_object_ptr = new T(js_context);
+			auto native_object_ptr = CreateNativeObject(js_context, this_object);
 			native_object_ptr->postInitialize(this_object);
-			this_object.SetPrivate(reinterpret_cast<std::uintptr_t>(native_object_ptr), [](const std::uintptr_t& native_ptr) {
-				delete reinterpret_cast<T*>(native_ptr);
-			});
+			this_object.SetPrivateWithFinalizer(reinterpret_cast<std::uintptr_t>(native_object_ptr), FinalizeNativeObject);
 			native_object_ptr->postCallAsConstructor(js_context, arguments);
 		};
+
+	private:
+		// The allocator is looked up only here so that JSExportAllocator can
+		// be specialized after the class it allocates has been defined.
+		// The object is recorded in its peer so get_object() needs no lookup.
+		static T* CreateNativeObject(const JSContext& js_context, const JSObject& this_object) {
+			typedef typename JSExportAllocator<T>::type allocator_type;
+			typedef std::allocator_traits<allocator_type> allocator_traits;
+			allocator_type allocator;
+			const auto native_object_ptr = allocator_traits::allocate(allocator, 1);
+			allocator_traits::construct(allocator, native_object_ptr, js_context);
+			native_object_ptr->js_api_object__ = static_cast<jerry_api_value_t>(this_object).v_object;
+			return native_object_ptr;
+		}
+
+		// The type is known here, so finalization needs no lookup.
+		static void FinalizeNativeObject(const std::uintptr_t native_ptr) {
+			typedef typename JSExportAllocator<T>::type allocator_type;
+			typedef std::allocator_traits<allocator_type> allocator_traits;
+			allocator_type allocator;
+			const auto native_object_ptr = reinterpret_cast<T*>(native_ptr);
+			allocator_traits::destroy(allocator, native_object_ptr);
+			allocator_traits::deallocate(allocator, native_object_ptr, 1);
+		}
 	};
 
 	template<typename T>
@@ -51,12 +89,10 @@ namespace Daisy {
 
 	template<typename T>
 	void JSExportClass<T>::ConstructorInitializeCallback(const JSContext& js_context, JSObject& this_object) const {
-		js_class_parent__.ConstructorInitializeCallback(js_context, this_object);
-
 		JSClass::ConstructorInitializeCallback(js_context, this_object);
-		auto native_object_ptr = new T(js_context);
+		auto native_object_ptr = CreateNativeObject(js_context, this_object);
 		native_object_ptr->postInitialize(this_object);
-		this_object.SetPrivate(reinterpret_cast<std::uintptr_t>(native_object_ptr), js_object_finalize_callback__);
+		this_object.SetPrivateWithFinalizer(reinterpret_cast<std::uintptr_t>(native_object_ptr), FinalizeNativeObject);
 	}
 
 } // namespace Daisy {
@@ -0,0 +1,72 @@
+/**
+ * Copyright (c) 2015 by Kota Iguchi. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _DAISY_JSHANDLESCOPE_HPP_
+#define _DAISY_JSHANDLESCOPE_HPP_
+
+#include "Daisy/detail/JSBase.hpp"
+#include "Daisy/JSValue.hpp"
+#include "jerry.h"
+
+namespace Daisy {
+
+	/*!
+	 * While a handle scope is open on a thread, strings and objects that
+	 * are wrapped on that thread do not get a reference count of their
+	 * own: the scope holds their engine references and releases them all
+	 * when it closes, and copying such a wrapper costs nothing. Wrappers
+	 * created in a scope must not be used after it closes; use Escape to
+	 * hand a value to the enclosing code. Scopes nest and must be closed
+	 * in reverse order of opening.
+	 */
+	class DAISY_EXPORT JSHandleScope final {
+	public:
+		JSHandleScope() DAISY_NOEXCEPT;
+		~JSHandleScope() DAISY_NOEXCEPT;
+
+		// Return a wrapper of the value that stays valid after this scope
+		// closes. It belongs to the enclosing scope, or owns its reference
+		// if there is none. Only the innermost scope can escape values.
+		template<typename T>
+		T Escape(const T& value) {
+			return T(EscapeValue(value));
+		}
+
+		// Return a wrapper of the value that owns its reference no matter
+		// which scopes are open, for values that are kept beyond them.
+		template<typename T>
+		static T Persist(const T& value) {
+			return T(PersistValue(value));
+		}
+
+		// Number of engine references held by this scope, which must be
+		// the innermost one.
+		std::size_t size() const DAISY_NOEXCEPT;
+
+	private:
+		friend JSValue;
+
+		JSHandleScope(const JSHandleScope&)            = delete;
+		JSHandleScope& operator=(const JSHandleScope&) = delete;
+
+		// Prevent heap based objects.
+		void* operator new(std::size_t)     = delete; // #1: To prevent allocation of scalar objects
+		void* operator new [] (std::size_t) = delete; // #2: To prevent allocation of array of objects
+
+		JSValue EscapeValue(const JSValue& js_value);
+		static JSValue PersistValue(const JSValue& js_value);
+
+		// Take over the engine reference of a new wrapper if a scope is
+		// open on this thread; return false if there is none.
+		static bool Adopt(const jerry_api_value_t& js_api_value) DAISY_NOEXCEPT;
+
+		JSHandleScope* parent__;
+		std::size_t    begin__;
+	};
+
+} // namespace Daisy {
+
+#endif // _DAISY_JSHANDLESCOPE_HPP_
@@ -9,7 +9,10 @@
 
 #include "Daisy/JSValue.hpp"
 #include "Daisy/JSClass.hpp"
+#include "Daisy/JSPropertyKey.hpp"
 #include <vector>
+#include <initializer_list>
+#include <utility>
 #include <functional>
 #include <memory>
 
@@ -37,11 +40,26 @@ namespace Daisy {
 		virtual std::uintptr_t GetPrivate() const;
 		virtual void SetPrivate(const std::uintptr_t& native_ptr, const JSObjectFinalizeCallback finalize_callback);
 
+		// Like SetPrivate, but the finalizer is a plain function that is kept
+		// with the object and called directly when the object is collected.
+		virtual void SetPrivateWithFinalizer(const std::uintptr_t& native_ptr, const JSObjectFinalizeFunction finalize_function);
+
 		virtual bool HasProperty(const std::string& name) const;
 		virtual JSValue GetProperty(const std::string& name) const;
 		virtual void SetProperty(const std::string& name, JSValue js_value);
+		virtual bool HasProperty(const JSPropertyKey& key) const;
+		virtual JSValue GetProperty(const JSPropertyKey& key) const;
+		virtual void SetProperty(const JSPropertyKey& key, JSValue js_value);
+		virtual void SetProperties(std::initializer_list<std::pair<JSPropertyKey, JSValue>> properties);
+		virtual void SetProperties(std::initializer_list<std::pair<std::string, JSValue>> properties);
 		virtual std::vector<std::string> GetPropertyNames() const DAISY_NOEXCEPT;
 
+		// Read the elements of an array or an array-like object in one
+		// engine call. Reading stops at an element whose getter throws.
+		template<typename T>
+		std::vector<T> ToVector() const DAISY_NOEXCEPT;
+
+		explicit JSObject(const JSValue&) DAISY_NOEXCEPT;
 		JSObject(const JSContext&)     DAISY_NOEXCEPT;
 		JSObject(const JSContext&, const JSClass&)     DAISY_NOEXCEPT;
 		virtual ~JSObject()            DAISY_NOEXCEPT;
@@ -52,19 +70,11 @@ namespace Daisy {
 		JSObject(const JSContext& js_context, const jerry_api_value_t& js_api_value) DAISY_NOEXCEPT;
 		JSObject(const JSContext& js_context, const jerry_api_object_t* js_api_object, const bool& managed = true) DAISY_NOEXCEPT;
 
-		static void FinalizePrivateData(std::uintptr_t native_ptr);
-		static JSObject FindJSObjectFromPrivateData(const JSContext& js_context, const std::uintptr_t& native_ptr);
-
 		// Silence 4251 on Windows since private member variables do not
 		// need to be exported from a DLL.
 #pragma warning(push)
 #pragma warning(disable: 4251)
-		static std::unordered_map<std::uintptr_t, JSObjectFinalizeCallback> js_object_finalizeCallback_map__;
-		static std::unordered_map<const jerry_api_object_t*, JSObjectCallAsFunctionCallback> js_object_external_functions_map__;
-		static std::unordered_map<const jerry_api_object_t*, JSObjectCallAsConstructorCallback> js_object_external_constructors_map__;
-		static std::unordered_map<std::uintptr_t, const jerry_api_object_t*> js_private_data_to_js_object_ref_map__;
-		static std::unordered_map<const jerry_api_object_t*, std::unordered_map<std::string, JSValue>> js_object_properties_map__;
-		static jerry_api_object_t* js_api_global_object__;
+		static DAISY_THREAD_LOCAL jerry_api_object_t* js_api_global_object__;
 #pragma warning(pop)
 
 	protected:
@@ -95,6 +105,17 @@ namespace Daisy {
 		return std::shared_ptr<T>(std::make_shared<JSObject>(*this), reinterpret_cast<T*>(GetPrivate()));
 	}
 
+	template<typename T>
+	std::vector<T> JSObject::ToVector() const DAISY_NOEXCEPT {
+		return JSValueConverter<std::vector<T>>::FromApiValue(js_context__, js_api_value__);
+	}
+
+	// Defined here rather than with JSContext since it returns a JSObject.
+	template<typename T>
+	JSObject JSContext::CreateArray(const std::vector<T>& values) const DAISY_NOEXCEPT {
+		return JSObject(*this, JSValueConverter<std::vector<T>>::ToApiValue(values));
+	}
+
 } // namespace Daisy {
 
 #endif // _DAISY_JSOBJECT_HPP_
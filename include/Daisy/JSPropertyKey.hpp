@@ -0,0 +1,82 @@
+/**
+ * Copyright (c) 2015 by Kota Iguchi. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _DAISY_JSPROPERTYKEY_HPP_
+#define _DAISY_JSPROPERTYKEY_HPP_
+
+#include "Daisy/detail/JSBase.hpp"
+#include "Daisy/JSString.hpp"
+
+namespace Daisy {
+
+	class JSContext;
+	class JSObject;
+
+	/*!
+	 * A property name whose engine string is created once and reused.
+	 * Passing a JSPropertyKey to JSObject::GetProperty, SetProperty or
+	 * HasProperty skips building and hashing a new engine string on
+	 * every access, so keep one around for names used in hot paths.
+	 */
+	class DAISY_EXPORT JSPropertyKey final {
+	public:
+		explicit operator std::string() const DAISY_NOEXCEPT;
+		std::size_t hash_value() const;
+
+		~JSPropertyKey()                         DAISY_NOEXCEPT;
+		JSPropertyKey(const JSPropertyKey&)      DAISY_NOEXCEPT;
+		JSPropertyKey(JSPropertyKey&&)           DAISY_NOEXCEPT;
+		JSPropertyKey& operator=(JSPropertyKey)  DAISY_NOEXCEPT;
+		void swap(JSPropertyKey&)                DAISY_NOEXCEPT;
+
+	protected:
+		friend JSContext;
+		friend JSObject;
+
+		explicit JSPropertyKey(const JSString& js_name) DAISY_NOEXCEPT;
+
+		jerry_api_string_t* get_api_string() const DAISY_NOEXCEPT {
+			return static_cast<jerry_api_value_t>(js_name__).v_string;
+		}
+
+		DAISY_EXPORT friend bool operator==(const JSPropertyKey& lhs, const JSPropertyKey& rhs);
+
+		// Silence 4251 on Windows since private member variables do not
+		// need to be exported from a DLL.
+#pragma warning(push)
+#pragma warning(disable: 4251)
+		JSString js_name__;
+#pragma warning(pop)
+	};
+
+	// Return true if the two JSPropertyKeys name the same property.
+	DAISY_EXPORT bool operator==(const JSPropertyKey& lhs, const JSPropertyKey& rhs);
+
+	inline
+	bool operator!=(const JSPropertyKey& lhs, const JSPropertyKey& rhs) {
+		return ! (lhs == rhs);
+	}
+
+	inline
+	void swap(JSPropertyKey& first, JSPropertyKey& second) DAISY_NOEXCEPT {
+		first.swap(second);
+	}
+
+} // namespace Daisy {
+
+namespace std {
+	template<>
+	struct hash<Daisy::JSPropertyKey> {
+		using argument_type = Daisy::JSPropertyKey;
+		using result_type   = std::size_t;
+
+		result_type operator()(const argument_type& js_property_key) const {
+			return js_property_key.hash_value();
+		}
+	};
+}  // namespace std
+
+#endif // _DAISY_JSPROPERTYKEY_HPP_
@@ -0,0 +1,68 @@
+/**
+ * Copyright (c) 2015 by Kota Iguchi. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _DAISY_JSSCRIPT_HPP_
+#define _DAISY_JSSCRIPT_HPP_
+
+#include "Daisy/detail/JSBase.hpp"
+#include "Daisy/JSContext.hpp"
+#include "jerry.h"
+#include <cstdint>
+#include <vector>
+
+namespace Daisy {
+
+	class JSValue;
+
+	/*!
+	 * A script that is parsed once by JSContext::CreateScript and can then
+	 * be run any number of times without going through the parser again.
+	 * Every JSScript holds a reference to the compiled code, which is freed
+	 * once no JSScript or script cache entry refers to it and the functions
+	 * the script created are collected. A JSScript must not outlive the
+	 * JSContextGroup that created it.
+	 */
+	class DAISY_EXPORT JSScript final {
+	public:
+		// Return true if the source compiled without a syntax error.
+		bool IsCompiled() const DAISY_NOEXCEPT {
+			return js_api_script__ != nullptr;
+		}
+
+		JSValue Run() const;
+
+		// Serialize the compiled code into a snapshot that
+		// JSContext::EvaluateSnapshot runs without parsing the source.
+		std::vector<std::uint8_t> CreateSnapshot() const;
+
+		~JSScript()                     DAISY_NOEXCEPT;
+		JSScript(const JSScript&)       DAISY_NOEXCEPT;
+		JSScript(JSScript&&)            DAISY_NOEXCEPT;
+		JSScript& operator=(JSScript)   DAISY_NOEXCEPT;
+		void swap(JSScript&)            DAISY_NOEXCEPT;
+
+	private:
+		friend JSContext;
+
+		// Acquires a reference to js_api_script, which may be null.
+		JSScript(const JSContext& js_context, const jerry_api_script_t* js_api_script) DAISY_NOEXCEPT;
+
+		// Prevent heap based objects.
+		void* operator new(std::size_t)     = delete; // #1: To prevent allocation of scalar objects
+		void* operator new [] (std::size_t) = delete; // #2: To prevent allocation of array of objects
+
+		JSContext js_context__;
+		const jerry_api_script_t* js_api_script__;
+	};
+
+	inline
+	void swap(JSScript& first, JSScript& second) DAISY_NOEXCEPT {
+		first.swap(second);
+	}
+
+} // namespace Daisy {
+
+#endif // _DAISY_JSSCRIPT_HPP_
@@ -0,0 +1,150 @@
+/**
+ * Copyright (c) 2015 by Kota Iguchi. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _DAISY_JSSLABALLOCATOR_HPP_
+#define _DAISY_JSSLABALLOCATOR_HPP_
+
+#include "Daisy/detail/JSBase.hpp"
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace Daisy {
+
+	namespace detail {
+
+		/*!
+		 * Pool of fixed-size slots carved out of slabs. Freed slots go on a
+		 * free list and are handed out again before a new slab is allocated;
+		 * slabs are only released when the pool is destroyed.
+		 */
+		template<std::size_t Size, std::size_t Align>
+		class JSSlabPool final {
+#undef  DAISY_JSSLABPOOL_LOCK_GUARD
+#ifdef  DAISY_THREAD_SAFE
+			std::mutex mutex__;
+#define DAISY_JSSLABPOOL_LOCK_GUARD std::lock_guard<std::mutex> lock(mutex__)
+#else
+#define DAISY_JSSLABPOOL_LOCK_GUARD
+#endif  // DAISY_THREAD_SAFE
+
+		public:
+			static const std::size_t slots_per_slab = 64;
+
+			JSSlabPool() DAISY_NOEXCEPT {
+			}
+
+			~JSSlabPool() DAISY_NOEXCEPT {
+				for (const auto slab : slabs__) {
+					::operator delete(slab);
+				}
+			}
+
+			void* allocate() {
+				DAISY_JSSLABPOOL_LOCK_GUARD;
+				if (free_list__ == nullptr) {
+					grow();
+				}
+				const auto slot = free_list__;
+				free_list__ = slot->next;
+				return slot;
+			}
+
+			void deallocate(void* ptr) DAISY_NOEXCEPT {
+				DAISY_JSSLABPOOL_LOCK_GUARD;
+				const auto slot = static_cast<Slot*>(ptr);
+				slot->next  = free_list__;
+				free_list__ = slot;
+			}
+
+		private:
+			union Slot {
+				Slot* next;
+				typename std::aligned_storage<Size, Align>::type storage;
+			};
+
+			JSSlabPool(const JSSlabPool&)            = delete;
+			JSSlabPool& operator=(const JSSlabPool&) = delete;
+
+			void grow() {
+				const auto slab = static_cast<Slot*>(::operator new(sizeof(Slot) * slots_per_slab));
+				slabs__.push_back(slab);
+				for (std::size_t i = slots_per_slab; i > 0; i--) {
+					slab[i - 1].next = free_list__;
+					free_list__ = &slab[i - 1];
+				}
+			}
+
+			Slot*              free_list__ { nullptr };
+			std::vector<Slot*> slabs__;
+		};
+
+	} // namespace detail {
+
+	/*!
+	 * Allocator that serves single objects from a per-type slab pool.
+	 * Opt an exported class into it by specializing JSExportAllocator:
+	 *
+	 *   template<>
+	 *   struct JSExportAllocator<Widget> {
+	 *     typedef JSSlabAllocator<Widget> type;
+	 *   };
+	 */
+	template<typename T>
+	class JSSlabAllocator {
+	public:
+		typedef T value_type;
+
+		template<typename U>
+		struct rebind {
+			typedef JSSlabAllocator<U> other;
+		};
+
+		JSSlabAllocator() DAISY_NOEXCEPT {
+		}
+
+		template<typename U>
+		JSSlabAllocator(const JSSlabAllocator<U>&) DAISY_NOEXCEPT {
+		}
+
+		T* allocate(const std::size_t n) {
+			if (n == 1) {
+				return static_cast<T*>(pool().allocate());
+			}
+			return static_cast<T*>(::operator new(n * sizeof(T)));
+		}
+
+		void deallocate(T* ptr, const std::size_t n) DAISY_NOEXCEPT {
+			if (n == 1) {
+				pool().deallocate(ptr);
+			} else {
+				::operator delete(ptr);
+			}
+		}
+
+	private:
+		typedef detail::JSSlabPool<sizeof(T), std::alignment_of<T>::value> pool_type;
+
+		static pool_type& pool() {
+			static DAISY_THREAD_LOCAL pool_type js_slab_pool;
+			return js_slab_pool;
+		}
+	};
+
+	template<typename T, typename U>
+	bool operator==(const JSSlabAllocator<T>&, const JSSlabAllocator<U>&) DAISY_NOEXCEPT {
+		return true;
+	}
+
+	template<typename T, typename U>
+	bool operator!=(const JSSlabAllocator<T>&, const JSSlabAllocator<U>&) DAISY_NOEXCEPT {
+		return false;
+	}
+
+} // namespace Daisy {
+
+#endif // _DAISY_JSSLABALLOCATOR_HPP_
@@ -24,6 +24,15 @@ namespace Daisy {
 		operator std::string() const DAISY_NOEXCEPT;
 		std::size_t hash_value() const;
 
+		// Copy the UTF-8 bytes of this string into buffer without a
+		// terminating NUL. Returns the number of bytes written, or 0 if
+		// buffer_size is smaller than size().
+		std::size_t CopyTo(char* buffer, const std::size_t buffer_size) const DAISY_NOEXCEPT;
+
+		// Replace the contents of value with this string, reusing its capacity.
+		void CopyTo(std::string& value) const DAISY_NOEXCEPT;
+
+		explicit JSString(const JSValue&) DAISY_NOEXCEPT;
 		~JSString()                      DAISY_NOEXCEPT;
 		JSString(const JSString&)        DAISY_NOEXCEPT;
 		JSString(JSString&&)             DAISY_NOEXCEPT;
@@ -40,6 +49,10 @@ namespace Daisy {
 
 		static jerry_api_value_t MakeString(const std::string& value) DAISY_NOEXCEPT;
 		static std::string ToString(const jerry_api_value_t& value) DAISY_NOEXCEPT;
+		static void ToString(const jerry_api_value_t& value, std::string& result) DAISY_NOEXCEPT;
+
+		// The text and hash are only computed when first asked for.
+		const std::string& materialize() const DAISY_NOEXCEPT;
 
 		// Prevent heap based objects.
 		void* operator new(std::size_t)     = delete; // #1: To prevent allocation of scalar objects
@@ -63,8 +76,10 @@ namespace Daisy {
 		// need to be exported from a DLL.
 #pragma warning(push)
 #pragma warning(disable: 4251)
-		std::string string__;
-		std::size_t hash_value__;
+		mutable std::string string__;
+		mutable std::size_t hash_value__ { 0 };
+		mutable bool        string_materialized__ { false };
+		mutable bool        hash_computed__ { false };
 #pragma warning(pop)
 
 	};
@@ -12,12 +12,12 @@
 #include "jerry.h"
 #include <map>
 #include <unordered_map>
-#include <tuple>
 
 namespace Daisy {
 
 	class JSObject;
 	class JSString;
+	class JSHandleScope;
 
 	class DAISY_EXPORT JSValue {
 	public:
@@ -33,6 +33,11 @@ namespace Daisy {
 			return js_api_value__;
 		}
 
+		// Convert to a C++ value with JSValueConverter<T>, such as a
+		// number, a std::vector or a std::map with string keys.
+		template<typename T>
+		T To() const DAISY_NOEXCEPT;
+
 		~JSValue()                       DAISY_NOEXCEPT;
 		JSValue(const JSValue&)          DAISY_NOEXCEPT;
 		JSValue(JSValue&&)               DAISY_NOEXCEPT;
@@ -82,6 +87,7 @@ namespace Daisy {
 	protected:
 
 		friend JSContextGroup;
+		friend JSHandleScope;
 
 		// Prevent heap based objects.
 		void* operator new(std::size_t)     = delete; // #1: To prevent allocation of scalar objects
@@ -110,9 +116,12 @@ namespace Daisy {
     // need to be exported from a DLL.
 #pragma warning(push)
 #pragma warning(disable: 4251)
-		bool js_value_managed__ { true };
 		jerry_api_value_t js_api_value__;
-		static std::unordered_map<std::intptr_t, std::tuple<jerry_api_data_type_t, std::size_t>> js_api_value_retain_count_map__;
+		bool js_value_managed__ { true };
+
+		// Shared by every copy of a wrapper that owns one engine reference
+		// to a string or object. nullptr for primitives and unmanaged values.
+		std::size_t* js_api_value_retain_count__ { nullptr };
 #pragma warning(pop)
 
 	};
@@ -152,4 +161,7 @@ namespace Daisy {
 	}
 }
 
+// Defines JSValue::To and JSContext::CreateValue.
+#include "Daisy/JSValueConverter.hpp"
+
 #endif // _DAISY_JSVALUE_HPP_
\ No newline at end of file
@@ -0,0 +1,274 @@
+/**
+ * Copyright (c) 2015 by Kota Iguchi. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _DAISY_JSVALUECONVERTER_HPP_
+#define _DAISY_JSVALUECONVERTER_HPP_
+
+#include "Daisy/detail/JSBase.hpp"
+#include "Daisy/detail/JSUtil.hpp"
+#include "Daisy/JSValue.hpp"
+#include "jerry.h"
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace Daisy {
+
+	/*!
+	 * Converts a C++ value to and from an engine value. Numbers, bools
+	 * and strings are converted straight from the engine value, vectors
+	 * and tuples become arrays and maps with string keys become objects,
+	 * element by element, so a nested container is built or read in one
+	 * pass without wrappers or JSON text. JSValue and its subclasses wrap
+	 * the value. Specialize it to convert other types.
+	 *
+	 * ToApiValue returns a new reference; FromApiValue does not take over
+	 * the reference it is given.
+	 */
+	template<typename T, typename Enable = void>
+	struct JSValueConverter {
+		static_assert(std::is_base_of<JSValue, T>::value, "No JSValueConverter for this type");
+
+		static jerry_api_value_t ToApiValue(const T& value) DAISY_NOEXCEPT {
+			return detail::js_jerry_api_value_acquire(static_cast<jerry_api_value_t>(value));
+		}
+
+		static T FromApiValue(const JSContext& js_context, const jerry_api_value_t& js_api_value) DAISY_NOEXCEPT {
+			return static_cast<T>(JSValue(js_context, detail::js_jerry_api_value_acquire(js_api_value)));
+		}
+	};
+
+	namespace detail {
+		// Converts a number to an integral type the way ToInt32 and ToUint32
+		// do: NaN and infinities become 0, and the integer part is taken
+		// modulo 2 ^ N for an N-bit type, so no number is out of range.
+		template<typename T>
+		typename std::enable_if<std::is_integral<T>::value, T>::type js_number_to(const double value) DAISY_NOEXCEPT {
+			typedef typename std::make_unsigned<T>::type U;
+			if (!std::isfinite(value)) {
+				return T();
+			}
+			const double integer = std::fmod(std::trunc(value), std::ldexp(1.0, std::numeric_limits<U>::digits));
+			if (integer < 0) {
+				return static_cast<T>(U(0) - static_cast<U>(-integer));
+			}
+			return static_cast<T>(static_cast<U>(integer));
+		}
+
+		template<typename T>
+		typename std::enable_if<std::is_floating_point<T>::value, T>::type js_number_to(const double value) DAISY_NOEXCEPT {
+			return static_cast<T>(value);
+		}
+	} // namespace detail {
+
+	template<typename T>
+	struct JSValueConverter<T, typename std::enable_if<std::is_arithmetic<T>::value && !std::is_same<T, bool>::value>::type> {
+		static jerry_api_value_t ToApiValue(const T value) DAISY_NOEXCEPT {
+			jerry_api_value_t js_api_value;
+			js_api_value.type = JERRY_API_DATA_TYPE_FLOAT64;
+			js_api_value.v_float64 = static_cast<double>(value);
+			return js_api_value;
+		}
+
+		static T FromApiValue(const JSContext&, const jerry_api_value_t& js_api_value) DAISY_NOEXCEPT {
+			switch (js_api_value.type) {
+				case JERRY_API_DATA_TYPE_UINT32:  return detail::js_number_to<T>(js_api_value.v_uint32);
+				case JERRY_API_DATA_TYPE_FLOAT32: return detail::js_number_to<T>(js_api_value.v_float32);
+				case JERRY_API_DATA_TYPE_FLOAT64: return detail::js_number_to<T>(js_api_value.v_float64);
+				default:                          return T();
+			}
+		}
+	};
+
+	template<>
+	struct JSValueConverter<bool> {
+		static jerry_api_value_t ToApiValue(const bool value) DAISY_NOEXCEPT {
+			jerry_api_value_t js_api_value;
+			js_api_value.type = JERRY_API_DATA_TYPE_BOOLEAN;
+			js_api_value.v_bool = value;
+			return js_api_value;
+		}
+
+		static bool FromApiValue(const JSContext&, const jerry_api_value_t& js_api_value) DAISY_NOEXCEPT {
+			return js_api_value.type == JERRY_API_DATA_TYPE_BOOLEAN && js_api_value.v_bool;
+		}
+	};
+
+	template<>
+	struct JSValueConverter<std::string> {
+		static jerry_api_value_t ToApiValue(const std::string& value) DAISY_NOEXCEPT {
+			jerry_api_value_t js_api_value;
+			js_api_value.type = JERRY_API_DATA_TYPE_STRING;
+			js_api_value.v_string = jerry_api_create_string_sz(reinterpret_cast<const jerry_api_char_t*>(value.data()), static_cast<jerry_api_size_t>(value.size()));
+			return js_api_value;
+		}
+
+		// Values other than strings are converted as with String(value).
+		static std::string FromApiValue(const JSContext& js_context, const jerry_api_value_t& js_api_value) DAISY_NOEXCEPT {
+			if (js_api_value.type != JERRY_API_DATA_TYPE_STRING) {
+				return static_cast<std::string>(JSValue(js_context, detail::js_jerry_api_value_acquire(js_api_value)));
+			}
+			return detail::to_string(js_api_value.v_string);
+		}
+	};
+
+	namespace detail {
+		inline jerry_api_value_t js_jerry_api_value_make_object(jerry_api_object_t* js_api_object) DAISY_NOEXCEPT {
+			jerry_api_value_t js_api_value;
+			js_api_value.type = JERRY_API_DATA_TYPE_OBJECT;
+			js_api_value.v_object = js_api_object;
+			return js_api_value;
+		}
+
+		/*!
+		 * Converts a map with string keys to an object with a field per
+		 * entry, and the enumerable fields of an object back.
+		 */
+		template<typename M>
+		struct JSMapConverter {
+			typedef typename M::mapped_type mapped_type;
+			static_assert(std::is_same<typename M::key_type, std::string>::value, "Only maps with std::string keys can be converted");
+
+			static jerry_api_value_t ToApiValue(const M& value) DAISY_NOEXCEPT {
+				assert(value.size() <= UINT32_MAX);
+				// Fields are asked for in order, so the position is kept with the map.
+				auto position = value.begin();
+				return js_jerry_api_value_make_object(jerry_api_create_object_with_fields(static_cast<jerry_api_length_t>(value.size()),
+					[](const jerry_api_length_t, jerry_api_string_t** field_name, jerry_api_value_t* field_value, void* user_data) {
+						auto& position = *static_cast<typename M::const_iterator*>(user_data);
+						const auto& key = position->first;
+						*field_name  = jerry_api_create_string_sz(reinterpret_cast<const jerry_api_char_t*>(key.data()), static_cast<jerry_api_size_t>(key.size()));
+						*field_value = JSValueConverter<mapped_type>::ToApiValue(position->second);
+						++position;
+					}, &position));
+			}
+
+			static M FromApiValue(const JSContext& js_context, const jerry_api_value_t& js_api_value) DAISY_NOEXCEPT {
+				struct JSMapReader {
+					const JSContext& js_context;
+					M                values;
+				} reader { js_context, M() };
+				if (js_api_value.type == JERRY_API_DATA_TYPE_OBJECT) {
+					jerry_api_foreach_object_field(js_api_value.v_object, [](const jerry_api_string_t* field_name, const jerry_api_value_t* field_value, void* user_data) {
+						auto& reader = *static_cast<JSMapReader*>(user_data);
+						reader.values.emplace(to_string(field_name), JSValueConverter<mapped_type>::FromApiValue(reader.js_context, *field_value));
+						return true;
+					}, &reader);
+				}
+				return std::move(reader.values);
+			}
+		};
+	} // namespace detail {
+
+	// Arrays are converted from index 0 to their length; the elements of
+	// a value that is not an object are not read. No more elements are
+	// read than the engine heap could hold.
+	template<typename T, typename A>
+	struct JSValueConverter<std::vector<T, A>> {
+		static jerry_api_value_t ToApiValue(const std::vector<T, A>& value) DAISY_NOEXCEPT {
+			assert(value.size() <= UINT32_MAX);
+			return detail::js_jerry_api_value_make_object(jerry_api_create_array_object(static_cast<jerry_api_length_t>(value.size()),
+				[](const jerry_api_length_t index, jerry_api_value_t* element_value, void* user_data) {
+					*element_value = JSValueConverter<T>::ToApiValue((*static_cast<const std::vector<T, A>*>(user_data))[index]);
+				}, const_cast<std::vector<T, A>*>(&value)));
+		}
+
+		static std::vector<T, A> FromApiValue(const JSContext& js_context, const jerry_api_value_t& js_api_value) DAISY_NOEXCEPT {
+			struct JSArrayReader {
+				const JSContext&  js_context;
+				std::vector<T, A> values;
+			} reader { js_context, std::vector<T, A>() };
+			if (js_api_value.type == JERRY_API_DATA_TYPE_OBJECT) {
+				// Any array-like object can set its length, so only small
+				// arrays are reserved for up front.
+				reader.values.reserve(std::min<std::size_t>(jerry_api_get_array_length(js_api_value.v_object), 1024));
+				jerry_api_foreach_array_element(js_api_value.v_object, [](const jerry_api_length_t, const jerry_api_value_t* element_value, void* user_data) {
+					auto& reader = *static_cast<JSArrayReader*>(user_data);
+					reader.values.push_back(JSValueConverter<T>::FromApiValue(reader.js_context, *element_value));
+					return true;
+				}, &reader);
+			}
+			return std::move(reader.values);
+		}
+	};
+
+	template<typename V, typename C, typename A>
+	struct JSValueConverter<std::map<std::string, V, C, A>> : detail::JSMapConverter<std::map<std::string, V, C, A>> {
+	};
+
+	template<typename V, typename H, typename E, typename A>
+	struct JSValueConverter<std::unordered_map<std::string, V, H, E, A>> : detail::JSMapConverter<std::unordered_map<std::string, V, H, E, A>> {
+	};
+
+	// A tuple is an array of fixed length; missing elements are read as
+	// undefined.
+	template<typename... Ts>
+	struct JSValueConverter<std::tuple<Ts...>> {
+		typedef std::array<jerry_api_value_t, sizeof...(Ts)> JSApiValues;
+
+		static jerry_api_value_t ToApiValue(const std::tuple<Ts...>& value) DAISY_NOEXCEPT {
+			return ToApiValue(value, detail::JSMakeIndexSequence<sizeof...(Ts)>());
+		}
+
+		static std::tuple<Ts...> FromApiValue(const JSContext& js_context, const jerry_api_value_t& js_api_value) DAISY_NOEXCEPT {
+			JSApiValues elements;
+			for (auto& element : elements) {
+				element.type = JERRY_API_DATA_TYPE_UNDEFINED;
+			}
+			if (js_api_value.type == JERRY_API_DATA_TYPE_OBJECT) {
+				jerry_api_foreach_array_element(js_api_value.v_object, [](const jerry_api_length_t index, const jerry_api_value_t* element_value, void* user_data) {
+					auto& elements = *static_cast<JSApiValues*>(user_data);
+					if (index >= elements.size()) {
+						return false;
+					}
+					elements[index] = detail::js_jerry_api_value_acquire(*element_value);
+					return true;
+				}, &elements);
+			}
+			auto value = FromApiValues(js_context, elements, detail::JSMakeIndexSequence<sizeof...(Ts)>());
+			for (auto& element : elements) {
+				jerry_api_release_value(&element);
+			}
+			return value;
+		}
+
+	private:
+		template<std::size_t... I>
+		static jerry_api_value_t ToApiValue(const std::tuple<Ts...>& value, detail::JSIndexSequence<I...>) DAISY_NOEXCEPT {
+			JSApiValues elements {{ JSValueConverter<Ts>::ToApiValue(std::get<I>(value))... }};
+			return detail::js_jerry_api_value_make_object(jerry_api_create_array_object(static_cast<jerry_api_length_t>(elements.size()),
+				[](const jerry_api_length_t index, jerry_api_value_t* element_value, void* user_data) {
+					*element_value = (*static_cast<JSApiValues*>(user_data))[index];
+				}, &elements));
+		}
+
+		template<std::size_t... I>
+		static std::tuple<Ts...> FromApiValues(const JSContext& js_context, const JSApiValues& elements, detail::JSIndexSequence<I...>) DAISY_NOEXCEPT {
+			return std::tuple<Ts...>(JSValueConverter<Ts>::FromApiValue(js_context, elements[I])...);
+		}
+	};
+
+	template<typename T>
+	T JSValue::To() const DAISY_NOEXCEPT {
+		return JSValueConverter<T>::FromApiValue(js_context__, js_api_value__);
+	}
+
+	template<typename T>
+	JSValue JSContext::CreateValue(const T& value) const DAISY_NOEXCEPT {
+		return JSValue(*this, JSValueConverter<T>::ToApiValue(value));
+	}
+
+} // namespace Daisy {
+
+#endif // _DAISY_JSVALUECONVERTER_HPP_
@@ -11,11 +11,19 @@
 
 #include "Daisy/JSContextGroup.hpp"
 #include "Daisy/JSContext.hpp"
+#include "Daisy/JSContextExecutor.hpp"
+#include "Daisy/JSEventLoop.hpp"
+#include "Daisy/JSScript.hpp"
+#include "Daisy/JSSlabAllocator.hpp"
 #include "Daisy/JSValue.hpp"
+#include "Daisy/JSValueConverter.hpp"
+#include "Daisy/JSHandleScope.hpp"
 #include "Daisy/JSString.hpp"
+#include "Daisy/JSPropertyKey.hpp"
 #include "Daisy/JSNumber.hpp"
 #include "Daisy/JSBoolean.hpp"
 #include "Daisy/JSObject.hpp"
+#include "Daisy/JSArguments.hpp"
 #include "Daisy/JSClass.hpp"
 #include "Daisy/JSExport.hpp"
 
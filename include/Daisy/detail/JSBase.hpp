@@ -27,6 +27,14 @@
 #include <mutex>
 #endif
 
+// With contexts enabled every thread runs an engine of its own, so
+// Daisy's bookkeeping for the engine is kept per thread as well.
+#ifdef DAISY_ENABLE_CONTEXTS
+#define DAISY_THREAD_LOCAL thread_local
+#else
+#define DAISY_THREAD_LOCAL
+#endif
+
 #include "DAISY_EXPORT.h"
 #include <utility>
 #include <cstdint>
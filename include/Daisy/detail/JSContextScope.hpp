@@ -0,0 +1,43 @@
+/**
+ * Copyright (c) 2015 by Kota Iguchi. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _DAISY_DETAIL_JSCONTEXTSCOPE_HPP_
+#define _DAISY_DETAIL_JSCONTEXTSCOPE_HPP_
+
+#include "Daisy/detail/JSBase.hpp"
+
+namespace Daisy {
+	class JSContext;
+	namespace detail {
+
+	/*!
+	 * Marks the context that is entering the engine on the current
+	 * thread, so that native callbacks can pick it up instead of
+	 * creating a JSContextGroup on every call. Scopes nest, and the
+	 * enclosing context is restored when a scope ends.
+	 */
+	class DAISY_EXPORT JSContextScope final {
+	public:
+		explicit JSContextScope(const JSContext& js_context) DAISY_NOEXCEPT;
+		~JSContextScope() DAISY_NOEXCEPT;
+
+		// Return the innermost context that entered the engine on this thread.
+		static const JSContext& current() DAISY_NOEXCEPT;
+
+	private:
+		JSContextScope(const JSContextScope&)            = delete;
+		JSContextScope& operator=(const JSContextScope&) = delete;
+
+		// Prevent heap based objects.
+		void* operator new(std::size_t)     = delete; // #1: To prevent allocation of scalar objects
+		void* operator new [] (std::size_t) = delete; // #2: To prevent allocation of array of objects
+
+		const JSContext* previous__;
+	};
+
+}} // namespace Daisy { namespace detail {
+
+#endif // _DAISY_DETAIL_JSCONTEXTSCOPE_HPP_
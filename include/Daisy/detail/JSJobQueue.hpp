@@ -0,0 +1,75 @@
+/**
+ * Copyright (c) 2015 by Kota Iguchi. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _DAISY_DETAIL_JSJOBQUEUE_HPP_
+#define _DAISY_DETAIL_JSJOBQUEUE_HPP_
+
+#include "Daisy/detail/JSBase.hpp"
+#include <atomic>
+
+namespace Daisy {
+
+	class JSContext;
+
+	namespace detail {
+
+	/*!
+	 * Unit of work that JSJobQueue carries to the engine thread. The link
+	 * is part of the job so that pushing never allocates.
+	 */
+	class DAISY_EXPORT JSJob {
+	public:
+		JSJob() DAISY_NOEXCEPT {}
+		virtual ~JSJob() DAISY_NOEXCEPT {}
+		virtual void Run(JSContext& js_context) = 0;
+
+	private:
+		friend class JSJobQueue;
+
+		JSJob(const JSJob&)            = delete;
+		JSJob& operator=(const JSJob&) = delete;
+
+		std::atomic<JSJob*> next__ { nullptr };
+	};
+
+	/*!
+	 * Intrusive multiple-producer single-consumer queue. Push is wait-free
+	 * and may be called from any thread; Pop must only be called from the
+	 * thread that consumes the queue. The queue owns the jobs in it.
+	 */
+	class DAISY_EXPORT JSJobQueue final {
+	public:
+		JSJobQueue() DAISY_NOEXCEPT;
+		~JSJobQueue() DAISY_NOEXCEPT;
+
+		void Push(JSJob* js_job) DAISY_NOEXCEPT;
+
+		// Return the oldest job, or nullptr if the queue is empty or the
+		// next job is still being linked in by its producer.
+		JSJob* Pop() DAISY_NOEXCEPT;
+
+	private:
+		JSJobQueue(const JSJobQueue&)            = delete;
+		JSJobQueue& operator=(const JSJobQueue&) = delete;
+
+		class JSStubJob final : public JSJob {
+		public:
+			virtual void Run(JSContext&) override {}
+		};
+
+		// Silence 4251 on Windows since private member variables do not
+		// need to be exported from a DLL.
+#pragma warning(push)
+#pragma warning(disable: 4251)
+		std::atomic<JSJob*> head__;
+		JSJob*              tail__;
+		JSStubJob           stub__;
+#pragma warning(pop)
+	};
+
+}} // namespace Daisy { namespace detail {
+
+#endif // _DAISY_DETAIL_JSJOBQUEUE_HPP_
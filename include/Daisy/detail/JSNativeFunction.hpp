@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2015 by Kota Iguchi. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _DAISY_DETAIL_JSNATIVEFUNCTION_HPP_
+#define _DAISY_DETAIL_JSNATIVEFUNCTION_HPP_
+
+#include "Daisy/detail/JSBase.hpp"
+#include "Daisy/JSContext.hpp"
+#include "Daisy/JSValue.hpp"
+#include "Daisy/JSValueConverter.hpp"
+#include "Daisy/JSObject.hpp"
+#include "Daisy/JSArguments.hpp"
+#include "jerry.h"
+#include <type_traits>
+
+namespace Daisy { namespace detail {
+
+	/*!
+	 * Converts an argument of a native callback to a C++ parameter type
+	 * with JSValueConverter, reading the engine value in place.
+	 */
+	template<typename T>
+	struct JSNativeArgument {
+		static T Get(const JSContext& js_context, const JSArguments& arguments, const std::size_t index) DAISY_NOEXCEPT {
+			return JSValueConverter<T>::FromApiValue(js_context, arguments.get_api_value(index));
+		}
+	};
+
+	/*!
+	 * Converts the return value of a native method to a JSValue.
+	 */
+	template<typename R>
+	struct JSNativeResult {
+		static JSValue Make(const JSContext& js_context, const R& result) DAISY_NOEXCEPT {
+			return JSValue(js_context, JSValueConverter<R>::ToApiValue(result));
+		}
+	};
+
+	/*!
+	 * Calls a member function with arguments converted from a native
+	 * callback. Parameter and return types are deduced from the member
+	 * function pointer, so each binding is its own generated code.
+	 */
+	template<typename T, typename R, typename... Args>
+	struct JSNativeMethod {
+		template<typename M, std::size_t... I>
+		static JSValue Call(T& t, const M method, const JSArguments& arguments, JSIndexSequence<I...>) {
+			const auto js_context = arguments.get_context();
+			return JSNativeResult<typename std::decay<R>::type>::Make(js_context,
+				(t.*method)(JSNativeArgument<typename std::decay<Args>::type>::Get(js_context, arguments, I)...));
+		}
+	};
+
+	template<typename T, typename... Args>
+	struct JSNativeMethod<T, void, Args...> {
+		template<typename M, std::size_t... I>
+		static JSValue Call(T& t, const M method, const JSArguments& arguments, JSIndexSequence<I...>) {
+			const auto js_context = arguments.get_context();
+			(t.*method)(JSNativeArgument<typename std::decay<Args>::type>::Get(js_context, arguments, I)...);
+			return js_context.CreateUndefined();
+		}
+	};
+
+	// Like JavaScript, missing arguments are passed as undefined and extra
+	// arguments are ignored.
+	template<typename T, typename R, typename... Args, typename M>
+	JSValue CallNativeMethod(T& t, const M method, const JSArguments& arguments) {
+		return JSNativeMethod<T, R, Args...>::Call(t, method, arguments, JSMakeIndexSequence<sizeof...(Args)>());
+	}
+
+}} // namespace Daisy { namespace detail {
+
+#endif // _DAISY_DETAIL_JSNATIVEFUNCTION_HPP_
@@ -0,0 +1,63 @@
+/**
+ * Copyright (c) 2015 by Kota Iguchi. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _DAISY_DETAIL_JSOBJECTDATA_HPP_
+#define _DAISY_DETAIL_JSOBJECTDATA_HPP_
+
+#include "Daisy/detail/JSBase.hpp"
+#include "Daisy/JSClass.hpp"
+#include "jerry.h"
+
+namespace Daisy { namespace detail {
+
+	/*!
+	 * Native record that Daisy attaches to an engine object through its
+	 * native handle slot. Callbacks of external functions live here so
+	 * that dispatching a call is a single handle fetch, and the record is
+	 * released by the engine when the object is garbage collected.
+	 */
+	class DAISY_EXPORT JSObjectData final {
+	public:
+		// Return the record attached to the object, or nullptr if there is none.
+		static JSObjectData* Get(const jerry_api_object_t* js_api_object) DAISY_NOEXCEPT;
+
+		// Return the record attached to the object, creating one if needed.
+		static JSObjectData* Ensure(jerry_api_object_t* js_api_object) DAISY_NOEXCEPT;
+
+		// When deferred, private data of collected objects is queued
+		// instead of being finalized while the engine is sweeping.
+		static void SetFinalizationDeferred(const bool deferred) DAISY_NOEXCEPT;
+		static bool IsFinalizationDeferred() DAISY_NOEXCEPT;
+		static std::size_t GetPendingFinalizationCount() DAISY_NOEXCEPT;
+
+		// Finalize up to max_count queued private data in the order they
+		// were collected, and return how many were finalized.
+		static std::size_t DrainFinalizationQueue(const std::size_t max_count);
+
+		// Silence 4251 on Windows since private member variables do not
+		// need to be exported from a DLL.
+#pragma warning(push)
+#pragma warning(disable: 4251)
+		JSObjectCallAsFunctionCallback    call_as_function_callback__;
+		JSObjectCallAsConstructorCallback call_as_constructor_callback__;
+		std::uintptr_t                    private_data__ { 0 };
+		JSObjectFinalizeCallback          private_data_finalize_callback__;
+		JSObjectFinalizeFunction          private_data_finalize_function__ { nullptr };
+#pragma warning(pop)
+
+	private:
+		JSObjectData()  = default;
+		~JSObjectData() = default;
+		JSObjectData(const JSObjectData&)            = delete;
+		JSObjectData& operator=(const JSObjectData&) = delete;
+
+		// Called by the engine while the object is being swept; must not touch the engine.
+		static void Free(const std::uintptr_t native_ptr);
+	};
+
+}} // namespace Daisy { namespace detail {
+
+#endif // _DAISY_DETAIL_JSOBJECTDATA_HPP_
@@ -9,6 +9,7 @@
 
 #include "Daisy/detail/JSBase.hpp"
 #include "jerry.h"
+#include <string>
 #include <vector>
 
 namespace Daisy {
@@ -18,6 +19,52 @@ namespace Daisy {
 		DAISY_EXPORT std::vector<jerry_api_value_t> to_vector(const std::vector<JSValue>&);
 		DAISY_EXPORT std::vector<JSValue> to_vector(const JSContext& js_context, const jerry_api_value_t[], const jerry_api_length_t);
 		DAISY_EXPORT void js_jerry_api_value_make_copy(const jerry_api_value_t& from, jerry_api_value_t* to);
+		DAISY_EXPORT jerry_api_value_t js_jerry_api_value_acquire(const jerry_api_value_t& js_api_value);
+		DAISY_EXPORT std::string to_string(const jerry_api_string_t* js_api_string);
+
+		template<std::size_t... I>
+		struct JSIndexSequence {
+		};
+
+		template<std::size_t N, std::size_t... I>
+		struct JSMakeIndexSequence : JSMakeIndexSequence<N - 1, N - 1, I...> {
+		};
+
+		template<std::size_t... I>
+		struct JSMakeIndexSequence<0, I...> : JSIndexSequence<I...> {
+		};
+
+		/*!
+		 * Engine values for an outbound call. Short argument lists are kept
+		 * in an inline buffer so that a call does not allocate; longer ones
+		 * fall back to the heap.
+		 */
+		class DAISY_EXPORT JSApiValueArray final {
+		public:
+			static const std::size_t inline_capacity = 8;
+
+			explicit JSApiValueArray(const std::vector<JSValue>& js_values) DAISY_NOEXCEPT;
+
+			const jerry_api_value_t* data() const DAISY_NOEXCEPT {
+				return data__;
+			}
+
+			jerry_api_length_t size() const DAISY_NOEXCEPT {
+				return size__;
+			}
+
+		private:
+			JSApiValueArray(const JSApiValueArray&)            = delete;
+			JSApiValueArray& operator=(const JSApiValueArray&) = delete;
+
+#pragma warning(push)
+#pragma warning(disable: 4251)
+			jerry_api_value_t              inline_values__[inline_capacity];
+			std::vector<jerry_api_value_t> heap_values__;
+			jerry_api_value_t*             data__;
+			jerry_api_length_t             size__;
+#pragma warning(pop)
+		};
 	} // namespace detail {
 } // namespace Daisy {
 
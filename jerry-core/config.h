@@ -32,51 +32,77 @@
 
 /**
  * Log2 of maximum number of chunks in a pool
+ *
+ * Free chunks of a pool are tracked in a 64-bit bitmap, so the value should not exceed 6.
+ */
+#define CONFIG_MEM_POOL_MAX_CHUNKS_NUMBER_LOG (6)
+
+/**
+ * Log2 of maximum possible offset in the heap
+ *
+ * The option affects size of compressed pointer that in turn
+ * affects size of ECMA Object Model's data types.
+ *
+ * In any case size of any of the types should not exceed CONFIG_MEM_POOL_CHUNK_SIZE.
+ *
+ * On the other hand, value 2 ^ CONFIG_MEM_HEAP_OFFSET_LOG is the maximum heap size
+ * that can be requested at initialization.
+ *
+ * Completion values hold a compressed pointer in 24 bits, so the heap can't exceed 32 megabytes.
  */
-#define CONFIG_MEM_POOL_MAX_CHUNKS_NUMBER_LOG (8)
+#ifndef CONFIG_MEM_HEAP_OFFSET_LOG
+# define CONFIG_MEM_HEAP_OFFSET_LOG (18)
+#elif CONFIG_MEM_HEAP_OFFSET_LOG > 25
+# error "Currently, maximum 32 megabytes heap size is supported"
+#endif /* !CONFIG_MEM_HEAP_OFFSET_LOG */
 
 /**
  * Size of pool chunk
  *
  * Should not be less than size of any of ECMA Object Model's data types.
+ *
+ * Compressed pointers for heaps larger than 256 kilobytes don't fit into 8-byte descriptors.
  */
-#define CONFIG_MEM_POOL_CHUNK_SIZE (8)
+#if CONFIG_MEM_HEAP_OFFSET_LOG <= 18
+# define CONFIG_MEM_POOL_CHUNK_SIZE (8)
+#else /* CONFIG_MEM_HEAP_OFFSET_LOG > 18 */
+# define CONFIG_MEM_POOL_CHUNK_SIZE (16)
+#endif /* CONFIG_MEM_HEAP_OFFSET_LOG > 18 */
 
 /**
  * Minimum number of chunks in a pool allocated by pools' manager.
  */
 #define CONFIG_MEM_LEAST_CHUNK_NUMBER_IN_POOL (32)
 
+/**
+ * Maximum number of empty pools kept by pools' manager instead of being returned to the heap.
+ *
+ * The pools are returned when the engine runs short of memory.
+ */
+#define CONFIG_MEM_POOLS_KEPT_EMPTY_POOLS_NUMBER (4)
+
 /**
  * Size of heap chunk
  */
 #define CONFIG_MEM_HEAP_CHUNK_SIZE (64)
 
 /**
- * Size of heap
+ * Default size of heap
+ *
+ * Used unless another size is passed to jerry_init_with_heap_size.
  */
 #ifndef CONFIG_MEM_HEAP_AREA_SIZE
 # define CONFIG_MEM_HEAP_AREA_SIZE (256 * 1024)
-#elif CONFIG_MEM_HEAP_AREA_SIZE > (256 * 1024)
-# error "Currently, maximum 256 kilobytes heap size is supported"
 #endif /* !CONFIG_MEM_HEAP_AREA_SIZE */
 
-/**
- * Desired limit of heap usage
- */
-#define CONFIG_MEM_HEAP_DESIRED_LIMIT (CONFIG_MEM_HEAP_AREA_SIZE / 32)
+#if CONFIG_MEM_HEAP_AREA_SIZE > (1u << CONFIG_MEM_HEAP_OFFSET_LOG)
+# error "Heap size should not exceed 2 ^ CONFIG_MEM_HEAP_OFFSET_LOG"
+#endif /* CONFIG_MEM_HEAP_AREA_SIZE > (1u << CONFIG_MEM_HEAP_OFFSET_LOG) */
 
 /**
- * Log2 of maximum possible offset in the heap
- *
- * The option affects size of compressed pointer that in turn
- * affects size of ECMA Object Model's data types.
- *
- * In any case size of any of the types should not exceed CONFIG_MEM_POOL_CHUNK_SIZE.
- *
- * On the other hand, value 2 ^ CONFIG_MEM_HEAP_OFFSET_LOG should not be less than CONFIG_MEM_HEAP_AREA_SIZE.
+ * Desired limit of heap usage, as log2 of the heap size's fraction
  */
-#define CONFIG_MEM_HEAP_OFFSET_LOG (18)
+#define CONFIG_MEM_HEAP_DESIRED_LIMIT_LOG (5)
 
 /**
  * Number of lower bits in key of literal hash table.
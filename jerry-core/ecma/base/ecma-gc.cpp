@@ -60,7 +60,7 @@ typedef enum
 /**
  * List of marked (visited during current GC session) and umarked objects
  */
-static ecma_object_t *ecma_gc_objects_lists[ECMA_GC_COLOR__COUNT];
+static JERRY_THREAD_LOCAL ecma_object_t *ecma_gc_objects_lists[ECMA_GC_COLOR__COUNT];
 
 /**
  * Current state of an object's visited flag that indicates whether the object is in visited state:
@@ -70,7 +70,7 @@ static ecma_object_t *ecma_gc_objects_lists[ECMA_GC_COLOR__COUNT];
  *          true  |            false  |      true
  *          true  |             true  |     false
  */
-static bool ecma_gc_visited_flip_flag = false;
+static JERRY_THREAD_LOCAL bool ecma_gc_visited_flip_flag = false;
 
 static void ecma_gc_mark (ecma_object_t *object_p);
 static void ecma_gc_sweep (ecma_object_t *object_p);
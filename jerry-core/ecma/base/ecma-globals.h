@@ -454,14 +454,18 @@ typedef struct ecma_object_t
                                     ECMA_OBJECT_GC_NEXT_CP_WIDTH)
 #define ECMA_OBJECT_GC_VISITED_WIDTH (1)
 
+/**
+ * Size of the common part
+ */
+#define ECMA_OBJECT_COMMON_SIZE (ECMA_OBJECT_GC_VISITED_POS + \
+                                 ECMA_OBJECT_GC_VISITED_WIDTH)
 
 /* Objects' only part */
 
 /**
  * Attribute 'Extensible'
  */
-#define ECMA_OBJECT_OBJ_EXTENSIBLE_POS (ECMA_OBJECT_GC_VISITED_POS + \
-                                        ECMA_OBJECT_GC_VISITED_WIDTH)
+#define ECMA_OBJECT_OBJ_EXTENSIBLE_POS (ECMA_OBJECT_TYPE_PART_POS)
 #define ECMA_OBJECT_OBJ_EXTENSIBLE_WIDTH (1)
 
 /**
@@ -497,8 +501,7 @@ typedef struct ecma_object_t
 /**
  * Type of lexical environment (ecma_lexical_environment_type_t).
  */
-#define ECMA_OBJECT_LEX_ENV_TYPE_POS (ECMA_OBJECT_GC_VISITED_POS + \
-                                        ECMA_OBJECT_GC_VISITED_WIDTH)
+#define ECMA_OBJECT_LEX_ENV_TYPE_POS (ECMA_OBJECT_TYPE_PART_POS)
 #define ECMA_OBJECT_LEX_ENV_TYPE_WIDTH (1)
 
 /**
@@ -521,9 +524,41 @@ typedef struct ecma_object_t
 #define ECMA_OBJECT_LEX_ENV_TYPE_SIZE (ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_POS + \
                                        ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_WIDTH)
 
+
+/**
+ * Position of objects' or lexical environments' only part
+ *
+ * The part follows the common part, unless compressed pointers are too wide
+ * for both to fit into one container; then it is placed in a separate one.
+ * The objects' part is the larger one.
+ */
+#if (ECMA_OBJECT_COMMON_SIZE + \
+     ECMA_OBJECT_OBJ_EXTENSIBLE_WIDTH + \
+     ECMA_OBJECT_OBJ_TYPE_WIDTH + \
+     ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_WIDTH + \
+     ECMA_OBJECT_OBJ_IS_BUILTIN_WIDTH) <= 64
+# define ECMA_OBJECT_TYPE_PART_POS (ECMA_OBJECT_COMMON_SIZE)
+#else /* the parts don't fit into one container */
+# define ECMA_OBJECT_HAS_TYPE_PART_CONTAINER
+# define ECMA_OBJECT_TYPE_PART_POS (0)
+#endif /* the parts don't fit into one container */
+
   uint64_t container; /**< container for fields described above */
+
+#ifdef ECMA_OBJECT_HAS_TYPE_PART_CONTAINER
+  uint64_t type_part_container; /**< container for objects' or lexical environments' only part */
+#endif /* ECMA_OBJECT_HAS_TYPE_PART_CONTAINER */
 } ecma_object_t;
 
+/**
+ * Container of objects' or lexical environments' only part
+ */
+#ifdef ECMA_OBJECT_HAS_TYPE_PART_CONTAINER
+# define ECMA_OBJECT_TYPE_PART_CONTAINER(object_p) ((object_p)->type_part_container)
+#else /* !ECMA_OBJECT_HAS_TYPE_PART_CONTAINER */
+# define ECMA_OBJECT_TYPE_PART_CONTAINER(object_p) ((object_p)->container)
+#endif /* !ECMA_OBJECT_HAS_TYPE_PART_CONTAINER */
+
 
 /**
  * Description of ECMA property descriptor
@@ -768,7 +803,7 @@ typedef struct
   mem_cpointer_t next_chunk_cp;
 
   /** Characters */
-  lit_utf8_byte_t data[ sizeof (uint64_t) - sizeof (mem_cpointer_t) ];
+  lit_utf8_byte_t data[ MEM_POOL_CHUNK_SIZE - sizeof (mem_cpointer_t) ];
 } ecma_collection_chunk_t;
 
 /**
@@ -850,7 +885,11 @@ typedef struct ecma_string_t
     lit_magic_string_ex_id_t magic_string_ex_id;
 
     /** For zeroing and comparison in some cases */
+#if ECMA_POINTER_FIELD_WIDTH <= 15
     uint32_t common_field;
+#else /* ECMA_POINTER_FIELD_WIDTH > 15 */
+    uint64_t common_field;
+#endif /* ECMA_POINTER_FIELD_WIDTH > 15 */
   } u;
 } ecma_string_t;
 
@@ -26,6 +26,7 @@
 #include "ecma-helpers.h"
 #include "ecma-lcache.h"
 #include "jrt-bit-fields.h"
+#include "serializer.h"
 
 /**
  * Create an object with specified prototype object
@@ -53,22 +54,22 @@ ecma_create_object (ecma_object_t *prototype_object_p, /**< pointer to prototybe
                                                  false,
                                                  ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_POS,
                                                  ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_WIDTH);
-  object_p->container = jrt_set_bit_field_value (object_p->container,
-                                                 is_extensible,
-                                                 ECMA_OBJECT_OBJ_EXTENSIBLE_POS,
-                                                 ECMA_OBJECT_OBJ_EXTENSIBLE_WIDTH);
-  object_p->container = jrt_set_bit_field_value (object_p->container,
-                                                 type,
-                                                 ECMA_OBJECT_OBJ_TYPE_POS,
-                                                 ECMA_OBJECT_OBJ_TYPE_WIDTH);
+  ECMA_OBJECT_TYPE_PART_CONTAINER (object_p) = jrt_set_bit_field_value (ECMA_OBJECT_TYPE_PART_CONTAINER (object_p),
+                                                                        is_extensible,
+                                                                        ECMA_OBJECT_OBJ_EXTENSIBLE_POS,
+                                                                        ECMA_OBJECT_OBJ_EXTENSIBLE_WIDTH);
+  ECMA_OBJECT_TYPE_PART_CONTAINER (object_p) = jrt_set_bit_field_value (ECMA_OBJECT_TYPE_PART_CONTAINER (object_p),
+                                                                        type,
+                                                                        ECMA_OBJECT_OBJ_TYPE_POS,
+                                                                        ECMA_OBJECT_OBJ_TYPE_WIDTH);
 
   uint64_t prototype_object_cp;
   ECMA_SET_POINTER (prototype_object_cp, prototype_object_p);
 
-  object_p->container = jrt_set_bit_field_value (object_p->container,
-                                                 prototype_object_cp,
-                                                 ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_POS,
-                                                 ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_WIDTH);
+  ECMA_OBJECT_TYPE_PART_CONTAINER (object_p) = jrt_set_bit_field_value (ECMA_OBJECT_TYPE_PART_CONTAINER (object_p),
+                                                                        prototype_object_cp,
+                                                                        ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_POS,
+                                                                        ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_WIDTH);
 
   ecma_set_object_is_builtin (object_p, false);
 
@@ -101,26 +102,29 @@ ecma_create_decl_lex_env (ecma_object_t *outer_lexical_environment_p) /**< outer
                                                                   ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_POS,
                                                                   ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_WIDTH);
 
-  new_lexical_environment_p->container = jrt_set_bit_field_value (new_lexical_environment_p->container,
-                                                                  ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE,
-                                                                  ECMA_OBJECT_LEX_ENV_TYPE_POS,
-                                                                  ECMA_OBJECT_LEX_ENV_TYPE_WIDTH);
+  ECMA_OBJECT_TYPE_PART_CONTAINER (new_lexical_environment_p) =
+    jrt_set_bit_field_value (ECMA_OBJECT_TYPE_PART_CONTAINER (new_lexical_environment_p),
+                             ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE,
+                             ECMA_OBJECT_LEX_ENV_TYPE_POS,
+                             ECMA_OBJECT_LEX_ENV_TYPE_WIDTH);
 
   uint64_t outer_reference_cp;
   ECMA_SET_POINTER (outer_reference_cp, outer_lexical_environment_p);
-  new_lexical_environment_p->container = jrt_set_bit_field_value (new_lexical_environment_p->container,
-                                                                  outer_reference_cp,
-                                                                  ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_POS,
-                                                                  ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_WIDTH);
+  ECMA_OBJECT_TYPE_PART_CONTAINER (new_lexical_environment_p) =
+    jrt_set_bit_field_value (ECMA_OBJECT_TYPE_PART_CONTAINER (new_lexical_environment_p),
+                             outer_reference_cp,
+                             ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_POS,
+                             ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_WIDTH);
 
   /*
    * Declarative lexical environments do not really have the flag,
    * but to not leave the value initialized, setting the flag to false.
    */
-  new_lexical_environment_p->container = jrt_set_bit_field_value (new_lexical_environment_p->container,
-                                                                  false,
-                                                                  ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_POS,
-                                                                  ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_WIDTH);
+  ECMA_OBJECT_TYPE_PART_CONTAINER (new_lexical_environment_p) =
+    jrt_set_bit_field_value (ECMA_OBJECT_TYPE_PART_CONTAINER (new_lexical_environment_p),
+                             false,
+                             ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_POS,
+                             ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_WIDTH);
 
   return new_lexical_environment_p;
 } /* ecma_create_decl_lex_env */
@@ -152,22 +156,25 @@ ecma_create_object_lex_env (ecma_object_t *outer_lexical_environment_p, /**< out
                                                                   ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_POS,
                                                                   ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_WIDTH);
 
-  new_lexical_environment_p->container = jrt_set_bit_field_value (new_lexical_environment_p->container,
-                                                                  ECMA_LEXICAL_ENVIRONMENT_OBJECTBOUND,
-                                                                  ECMA_OBJECT_LEX_ENV_TYPE_POS,
-                                                                  ECMA_OBJECT_LEX_ENV_TYPE_WIDTH);
+  ECMA_OBJECT_TYPE_PART_CONTAINER (new_lexical_environment_p) =
+    jrt_set_bit_field_value (ECMA_OBJECT_TYPE_PART_CONTAINER (new_lexical_environment_p),
+                             ECMA_LEXICAL_ENVIRONMENT_OBJECTBOUND,
+                             ECMA_OBJECT_LEX_ENV_TYPE_POS,
+                             ECMA_OBJECT_LEX_ENV_TYPE_WIDTH);
 
   uint64_t outer_reference_cp;
   ECMA_SET_POINTER (outer_reference_cp, outer_lexical_environment_p);
-  new_lexical_environment_p->container = jrt_set_bit_field_value (new_lexical_environment_p->container,
-                                                                  outer_reference_cp,
-                                                                  ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_POS,
-                                                                  ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_WIDTH);
-
-  new_lexical_environment_p->container = jrt_set_bit_field_value (new_lexical_environment_p->container,
-                                                                  provide_this,
-                                                                  ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_POS,
-                                                                  ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_WIDTH);
+  ECMA_OBJECT_TYPE_PART_CONTAINER (new_lexical_environment_p) =
+    jrt_set_bit_field_value (ECMA_OBJECT_TYPE_PART_CONTAINER (new_lexical_environment_p),
+                             outer_reference_cp,
+                             ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_POS,
+                             ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_WIDTH);
+
+  ECMA_OBJECT_TYPE_PART_CONTAINER (new_lexical_environment_p) =
+    jrt_set_bit_field_value (ECMA_OBJECT_TYPE_PART_CONTAINER (new_lexical_environment_p),
+                             provide_this,
+                             ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_POS,
+                             ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_WIDTH);
 
   uint64_t bound_object_cp;
   ECMA_SET_NON_NULL_POINTER (bound_object_cp, binding_obj_p);
@@ -201,7 +208,7 @@ ecma_get_object_extensible (const ecma_object_t *object_p) /**< object */
   JERRY_ASSERT (object_p != NULL);
   JERRY_ASSERT (!ecma_is_lexical_environment (object_p));
 
-  return (bool) jrt_extract_bit_field (object_p->container,
+  return (bool) jrt_extract_bit_field (ECMA_OBJECT_TYPE_PART_CONTAINER (object_p),
                                        ECMA_OBJECT_OBJ_EXTENSIBLE_POS,
                                        ECMA_OBJECT_OBJ_EXTENSIBLE_WIDTH);
 } /* ecma_get_object_extensible */
@@ -216,10 +223,10 @@ ecma_set_object_extensible (ecma_object_t *object_p, /**< object */
   JERRY_ASSERT (object_p != NULL);
   JERRY_ASSERT (!ecma_is_lexical_environment (object_p));
 
-  object_p->container = jrt_set_bit_field_value (object_p->container,
-                                                 is_extensible,
-                                                 ECMA_OBJECT_OBJ_EXTENSIBLE_POS,
-                                                 ECMA_OBJECT_OBJ_EXTENSIBLE_WIDTH);
+  ECMA_OBJECT_TYPE_PART_CONTAINER (object_p) = jrt_set_bit_field_value (ECMA_OBJECT_TYPE_PART_CONTAINER (object_p),
+                                                                        is_extensible,
+                                                                        ECMA_OBJECT_OBJ_EXTENSIBLE_POS,
+                                                                        ECMA_OBJECT_OBJ_EXTENSIBLE_WIDTH);
 } /* ecma_set_object_extensible */
 
 /**
@@ -231,7 +238,7 @@ ecma_get_object_type (const ecma_object_t *object_p) /**< object */
   JERRY_ASSERT (object_p != NULL);
   JERRY_ASSERT (!ecma_is_lexical_environment (object_p));
 
-  return (ecma_object_type_t) jrt_extract_bit_field (object_p->container,
+  return (ecma_object_type_t) jrt_extract_bit_field (ECMA_OBJECT_TYPE_PART_CONTAINER (object_p),
                                                      ECMA_OBJECT_OBJ_TYPE_POS,
                                                      ECMA_OBJECT_OBJ_TYPE_WIDTH);
 } /* ecma_get_object_type */
@@ -246,10 +253,10 @@ ecma_set_object_type (ecma_object_t *object_p, /**< object */
   JERRY_ASSERT (object_p != NULL);
   JERRY_ASSERT (!ecma_is_lexical_environment (object_p));
 
-  object_p->container = jrt_set_bit_field_value (object_p->container,
-                                                 type,
-                                                 ECMA_OBJECT_OBJ_TYPE_POS,
-                                                 ECMA_OBJECT_OBJ_TYPE_WIDTH);
+  ECMA_OBJECT_TYPE_PART_CONTAINER (object_p) = jrt_set_bit_field_value (ECMA_OBJECT_TYPE_PART_CONTAINER (object_p),
+                                                                        type,
+                                                                        ECMA_OBJECT_OBJ_TYPE_POS,
+                                                                        ECMA_OBJECT_OBJ_TYPE_WIDTH);
 } /* ecma_set_object_type */
 
 /**
@@ -262,7 +269,7 @@ ecma_get_object_prototype (const ecma_object_t *object_p) /**< object */
   JERRY_ASSERT (!ecma_is_lexical_environment (object_p));
 
   JERRY_ASSERT (sizeof (uintptr_t) * JERRY_BITSINBYTE >= ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_WIDTH);
-  uintptr_t prototype_object_cp = (uintptr_t) jrt_extract_bit_field (object_p->container,
+  uintptr_t prototype_object_cp = (uintptr_t) jrt_extract_bit_field (ECMA_OBJECT_TYPE_PART_CONTAINER (object_p),
                                                                      ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_POS,
                                                                      ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_WIDTH);
   return ECMA_GET_POINTER (ecma_object_t,
@@ -285,7 +292,7 @@ ecma_get_object_is_builtin (const ecma_object_t *object_p) /**< object */
 
   JERRY_ASSERT (sizeof (uintptr_t) * JERRY_BITSINBYTE >= width);
 
-  uintptr_t flag_value = (uintptr_t) jrt_extract_bit_field (object_p->container,
+  uintptr_t flag_value = (uintptr_t) jrt_extract_bit_field (ECMA_OBJECT_TYPE_PART_CONTAINER (object_p),
                                                             offset,
                                                             width);
 
@@ -305,10 +312,10 @@ ecma_set_object_is_builtin (ecma_object_t *object_p, /**< object */
   const uint32_t offset = ECMA_OBJECT_OBJ_IS_BUILTIN_POS;
   const uint32_t width = ECMA_OBJECT_OBJ_IS_BUILTIN_WIDTH;
 
-  object_p->container = jrt_set_bit_field_value (object_p->container,
-                                                 (uintptr_t) is_builtin,
-                                                 offset,
-                                                 width);
+  ECMA_OBJECT_TYPE_PART_CONTAINER (object_p) = jrt_set_bit_field_value (ECMA_OBJECT_TYPE_PART_CONTAINER (object_p),
+                                                                        (uintptr_t) is_builtin,
+                                                                        offset,
+                                                                        width);
 } /* ecma_set_object_is_builtin */
 
 /**
@@ -320,7 +327,7 @@ ecma_get_lex_env_type (const ecma_object_t *object_p) /**< lexical environment *
   JERRY_ASSERT (object_p != NULL);
   JERRY_ASSERT (ecma_is_lexical_environment (object_p));
 
-  return (ecma_lexical_environment_type_t) jrt_extract_bit_field (object_p->container,
+  return (ecma_lexical_environment_type_t) jrt_extract_bit_field (ECMA_OBJECT_TYPE_PART_CONTAINER (object_p),
                                                                   ECMA_OBJECT_LEX_ENV_TYPE_POS,
                                                                   ECMA_OBJECT_LEX_ENV_TYPE_WIDTH);
 } /* ecma_get_lex_env_type */
@@ -335,7 +342,7 @@ ecma_get_lex_env_outer_reference (const ecma_object_t *object_p) /**< lexical en
   JERRY_ASSERT (ecma_is_lexical_environment (object_p));
 
   JERRY_ASSERT (sizeof (uintptr_t) * JERRY_BITSINBYTE >= ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_WIDTH);
-  uintptr_t outer_reference_cp = (uintptr_t) jrt_extract_bit_field (object_p->container,
+  uintptr_t outer_reference_cp = (uintptr_t) jrt_extract_bit_field (ECMA_OBJECT_TYPE_PART_CONTAINER (object_p),
                                                                     ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_POS,
                                                                     ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_WIDTH);
   return ECMA_GET_POINTER (ecma_object_t,
@@ -391,7 +398,7 @@ ecma_get_lex_env_provide_this (const ecma_object_t *object_p) /**< object-bound
                 ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_OBJECTBOUND);
 
   JERRY_ASSERT (sizeof (uintptr_t) * JERRY_BITSINBYTE >= ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
-  bool provide_this = (jrt_extract_bit_field (object_p->container,
+  bool provide_this = (jrt_extract_bit_field (ECMA_OBJECT_TYPE_PART_CONTAINER (object_p),
                                               ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_POS,
                                               ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_WIDTH) != 0);
 
@@ -778,6 +785,13 @@ ecma_free_internal_property (ecma_property_t *property_p) /**< the property */
       break;
     }
 
+    case ECMA_INTERNAL_PROPERTY_CODE_BYTECODE: /* compressed pointer to a bytecode array */
+    {
+      serializer_release_bytecode (MEM_CP_GET_NON_NULL_POINTER (vm_instr_t, property_value));
+
+      break;
+    }
+
     case ECMA_INTERNAL_PROPERTY_NATIVE_CODE: /* an external pointer */
     case ECMA_INTERNAL_PROPERTY_NATIVE_HANDLE: /* an external pointer */
     case ECMA_INTERNAL_PROPERTY_FREE_CALLBACK: /* an external pointer */
@@ -793,7 +807,6 @@ ecma_free_internal_property (ecma_property_t *property_p) /**< the property */
     case ECMA_INTERNAL_PROPERTY_PROTOTYPE: /* the property's value is located in ecma_object_t */
     case ECMA_INTERNAL_PROPERTY_EXTENSIBLE: /* the property's value is located in ecma_object_t */
     case ECMA_INTERNAL_PROPERTY_CLASS: /* an enum */
-    case ECMA_INTERNAL_PROPERTY_CODE_BYTECODE: /* compressed pointer to a bytecode array */
     case ECMA_INTERNAL_PROPERTY_CODE_FLAGS_AND_OFFSET: /* an integer */
     case ECMA_INTERNAL_PROPERTY_BUILT_IN_ID: /* an integer */
     case ECMA_INTERNAL_PROPERTY_BUILT_IN_ROUTINE_ID: /* an integer */
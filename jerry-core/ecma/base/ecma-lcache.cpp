@@ -41,11 +41,11 @@ typedef struct
   /** Compressed pointer to a property of the object */
   mem_cpointer_t prop_cp;
 
-  /** Padding structure to 8 bytes size */
-  uint16_t padding;
+  /** Padding structure to 8 bytes size (16 bytes with wide compressed pointers) */
+  mem_cpointer_t padding;
 } ecma_lcache_hash_entry_t;
 
-JERRY_STATIC_ASSERT (sizeof (ecma_lcache_hash_entry_t) == sizeof (uint64_t));
+JERRY_STATIC_ASSERT (sizeof (ecma_lcache_hash_entry_t) == 4 * sizeof (mem_cpointer_t));
 
 /**
  * LCache hash value length, in bits
@@ -65,7 +65,7 @@ JERRY_STATIC_ASSERT (sizeof (ecma_lcache_hash_entry_t) == sizeof (uint64_t));
 /**
  * LCache's hash table
  */
-static ecma_lcache_hash_entry_t ecma_lcache_hash_table[ ECMA_LCACHE_HASH_ROWS_COUNT ][ ECMA_LCACHE_HASH_ROW_LENGTH ];
+static JERRY_THREAD_LOCAL ecma_lcache_hash_entry_t ecma_lcache_hash_table[ ECMA_LCACHE_HASH_ROWS_COUNT ][ ECMA_LCACHE_HASH_ROW_LENGTH ];
 #endif /* !CONFIG_ECMA_LCACHE_DISABLE */
 
 /**
@@ -42,7 +42,7 @@ static void ecma_instantiate_builtin (ecma_builtin_id_t id);
 /**
  * Pointer to instances of built-in objects
  */
-static ecma_object_t* ecma_builtin_objects[ECMA_BUILTIN_ID__COUNT];
+static JERRY_THREAD_LOCAL ecma_object_t* ecma_builtin_objects[ECMA_BUILTIN_ID__COUNT];
 
 /**
  * Check if passed object is the instance of specified built-in.
@@ -17,6 +17,7 @@
 #define ECMA_EVAL_H
 
 #include "ecma-globals.h"
+#include "opcodes.h"
 
 /** \addtogroup ecma ECMA
  * @{
@@ -35,6 +36,11 @@ ecma_op_eval_chars_buffer (const jerry_api_char_t *code_p,
                            bool is_direct,
                            bool is_called_from_strict_mode_code);
 
+extern ecma_completion_value_t
+ecma_op_eval_instrs (const vm_instr_t *instrs_p,
+                     bool is_direct,
+                     bool is_strict_call);
+
 /**
  * @}
  * @}
@@ -41,7 +41,7 @@
  *
  * See also: ECMA-262 v5, 10.2.3
  */
-ecma_object_t* ecma_global_lex_env_p = NULL;
+JERRY_THREAD_LOCAL ecma_object_t* ecma_global_lex_env_p = NULL;
 
 /**
  * Initialize Global environment
@@ -38,6 +38,8 @@ typedef enum
 {
   JERRY_COMPLETION_CODE_OK                  = 0, /**< successful completion */
   JERRY_COMPLETION_CODE_UNHANDLED_EXCEPTION = 1, /**< exception occured and it was not handled */
+  JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_FORMAT = 2, /**< snapshot was created by an incompatible engine
+                                                      *   or is corrupted */
 } jerry_completion_code_t;
 
 /**
@@ -100,6 +102,11 @@ typedef struct ecma_string_t jerry_api_string_t;
  */
 typedef struct ecma_object_t jerry_api_object_t;
 
+/**
+ * Jerry's compiled script
+ */
+typedef struct vm_instr_t jerry_api_script_t;
+
 /**
  * Description of an extension function's argument
  */
@@ -138,10 +145,64 @@ typedef bool (*jerry_external_handler_t) (const jerry_api_object_t *function_obj
  */
 typedef void (*jerry_object_free_callback_t) (const uintptr_t native_p);
 
+/**
+ * Callback of jerry_api_foreach_object_field_name
+ *
+ * The name is valid only during the call; it should be acquired to be kept.
+ *
+ * @return true - to continue iteration,
+ *         false - to stop it.
+ */
+typedef bool (*jerry_object_field_name_foreach_t) (const jerry_api_string_t *field_name_p,
+                                                   void *user_data_p);
+
+/**
+ * Callback of jerry_api_foreach_object_field
+ *
+ * Name and value are valid only during the call; they should be acquired to be kept.
+ *
+ * @return true - to continue iteration,
+ *         false - to stop it.
+ */
+typedef bool (*jerry_object_field_foreach_t) (const jerry_api_string_t *field_name_p,
+                                              const jerry_api_value_t *field_value_p,
+                                              void *user_data_p);
+
 extern EXTERN_C ssize_t
 jerry_api_string_to_char_buffer (const jerry_api_string_t *string_p,
                                  jerry_api_char_t *buffer_p,
                                  ssize_t buffer_size);
+/**
+ * Callback of jerry_api_create_array_object
+ *
+ * The callback writes the element at the index to the output value, which is taken over by the array.
+ */
+typedef void (*jerry_array_element_get_t) (jerry_api_length_t index,
+                                           jerry_api_value_t *element_value_p,
+                                           void *user_data_p);
+
+/**
+ * Callback of jerry_api_create_object_with_fields
+ *
+ * The callback writes the name and the value of the field at the index, which are taken over by the object.
+ */
+typedef void (*jerry_object_field_get_t) (jerry_api_length_t index,
+                                          jerry_api_string_t **field_name_p,
+                                          jerry_api_value_t *field_value_p,
+                                          void *user_data_p);
+
+/**
+ * Callback of jerry_api_foreach_array_element
+ *
+ * The value is valid only during the call; it should be acquired to be kept.
+ *
+ * @return true - to continue iteration,
+ *         false - to stop it.
+ */
+typedef bool (*jerry_array_element_foreach_t) (jerry_api_length_t index,
+                                               const jerry_api_value_t *element_value_p,
+                                               void *user_data_p);
+
 extern EXTERN_C
 jerry_api_string_t* jerry_api_acquire_string (jerry_api_string_t *string_p);
 extern EXTERN_C
@@ -162,6 +223,14 @@ jerry_api_string_t *jerry_api_create_string_sz (const jerry_api_char_t *, jerry_
 extern EXTERN_C
 jerry_api_object_t* jerry_api_create_object (void);
 extern EXTERN_C
+jerry_api_object_t* jerry_api_create_array_object (jerry_api_length_t length,
+                                                   jerry_array_element_get_t get_p,
+                                                   void *user_data_p);
+extern EXTERN_C
+jerry_api_object_t* jerry_api_create_object_with_fields (jerry_api_length_t fields_count,
+                                                         jerry_object_field_get_t get_p,
+                                                         void *user_data_p);
+extern EXTERN_C
 jerry_api_object_t* jerry_api_create_error (jerry_api_error_t error_type,
                                             const jerry_api_char_t *message_p);
 extern EXTERN_C
@@ -197,6 +266,11 @@ bool jerry_api_get_object_field_value_sz (jerry_api_object_t *object_p,
                                           jerry_api_size_t field_name_size,
                                           jerry_api_value_t *field_value_p);
 
+extern EXTERN_C
+bool jerry_api_get_object_field_value_by_string (jerry_api_object_t *object_p,
+                                                 jerry_api_string_t *field_name_p,
+                                                 jerry_api_value_t *field_value_p);
+
 extern EXTERN_C
 bool jerry_api_set_object_field_value (jerry_api_object_t *object_p,
                                        const jerry_api_char_t *field_name_p,
@@ -208,6 +282,34 @@ bool jerry_api_set_object_field_value_sz (jerry_api_object_t *object_p,
                                           jerry_api_size_t field_name_size,
                                           const jerry_api_value_t *field_value_p);
 
+extern EXTERN_C
+bool jerry_api_set_object_field_value_by_string (jerry_api_object_t *object_p,
+                                                 jerry_api_string_t *field_name_p,
+                                                 const jerry_api_value_t *field_value_p);
+
+extern EXTERN_C
+bool jerry_api_set_object_field_values (jerry_api_object_t *object_p,
+                                        jerry_api_string_t *const *field_names_p,
+                                        const jerry_api_value_t *field_values_p,
+                                        jerry_api_length_t fields_count);
+
+extern EXTERN_C
+bool jerry_api_foreach_object_field_name (jerry_api_object_t *object_p,
+                                          jerry_object_field_name_foreach_t foreach_p,
+                                          void *user_data_p);
+
+extern EXTERN_C
+bool jerry_api_foreach_object_field (jerry_api_object_t *object_p,
+                                     jerry_object_field_foreach_t foreach_p,
+                                     void *user_data_p);
+
+extern EXTERN_C
+jerry_api_length_t jerry_api_get_array_length (jerry_api_object_t *object_p);
+extern EXTERN_C
+bool jerry_api_foreach_array_element (jerry_api_object_t *object_p,
+                                      jerry_array_element_foreach_t foreach_p,
+                                      void *user_data_p);
+
 extern EXTERN_C
 bool jerry_api_get_object_native_handle (jerry_api_object_t *object_p, uintptr_t* out_handle_p);
 
@@ -216,6 +318,9 @@ void jerry_api_set_object_native_handle (jerry_api_object_t *object_p,
                                          uintptr_t handle,
                                          jerry_object_free_callback_t freecb_p);
 
+extern EXTERN_C
+void jerry_api_gc (void);
+
 extern EXTERN_C
 bool jerry_api_call_function (jerry_api_object_t *function_object_p,
                               jerry_api_object_t *this_arg_p,
@@ -236,6 +341,25 @@ jerry_completion_code_t jerry_api_eval (const jerry_api_char_t *source_p,
                                         bool is_strict,
                                         jerry_api_value_t *retval_p);
 
+extern EXTERN_C
+bool jerry_api_compile (const jerry_api_char_t *source_p,
+                        size_t source_size,
+                        const jerry_api_script_t **out_script_p);
+
+extern EXTERN_C
+const jerry_api_script_t* jerry_api_acquire_script (const jerry_api_script_t *script_p);
+extern EXTERN_C
+void jerry_api_release_script (const jerry_api_script_t *script_p);
+
+extern EXTERN_C
+jerry_completion_code_t jerry_api_run_script (const jerry_api_script_t *script_p,
+                                              jerry_api_value_t *retval_p);
+
+extern EXTERN_C
+size_t jerry_api_save_snapshot (const jerry_api_script_t *script_p,
+                                uint8_t *buffer_p,
+                                size_t buffer_size);
+
 extern EXTERN_C
 jerry_api_object_t* jerry_api_get_global (void);
 
@@ -16,6 +16,7 @@
 #include <stdio.h>
 
 #include "ecma-alloc.h"
+#include "ecma-array-object.h"
 #include "ecma-builtins.h"
 #include "ecma-exceptions.h"
 #include "ecma-eval.h"
@@ -50,12 +51,12 @@ const char *jerry_branch_name = JERRY_BRANCH_NAME;
 /**
  * Jerry run-time configuration flags
  */
-static jerry_flag_t jerry_flags;
+static JERRY_THREAD_LOCAL jerry_flag_t jerry_flags;
 
 /**
  * Jerry API availability flag
  */
-static bool jerry_api_available;
+static JERRY_THREAD_LOCAL bool jerry_api_available;
 
 /** \addtogroup jerry_extension Jerry engine extension interface
  * @{
@@ -429,6 +430,105 @@ jerry_api_create_object (void)
   return ecma_op_create_object_object_noarg ();
 } /* jerry_api_create_object */
 
+/**
+ * Add a writable, enumerable and configurable data property, that the object does not have yet,
+ * and move the value into it.
+ */
+static void
+jerry_api_add_new_data_property (ecma_object_t *obj_p, /**< object */
+                                 ecma_string_t *name_p, /**< property name */
+                                 jerry_api_value_t *api_value_p) /**< value, released by the call */
+{
+  ecma_value_t value;
+  jerry_api_convert_api_value_to_ecma_value (&value, api_value_p);
+  jerry_api_release_value (api_value_p);
+
+  ecma_property_t *prop_p = ecma_create_named_data_property (obj_p, name_p, true, true, true);
+  ecma_set_named_data_property_value (prop_p, value);
+
+  if (ecma_is_value_object (value))
+  {
+    /* the object holding the property is referenced, so the value stays reachable without a reference
+     * of its own; it is only dropped after being stored, as allocating the property can run GC */
+    ecma_deref_object (ecma_get_object_from_value (value));
+  }
+} /* jerry_api_add_new_data_property */
+
+/**
+ * Create an array object of the specified length and fill it with elements returned by the callback
+ *
+ * The elements are stored as data properties directly, without a call per element through
+ * the general property API and without building an intermediate list.
+ *
+ * Note:
+ *      caller should release the object with jerry_api_release_object, just when the value becomes unnecessary.
+ *
+ * @return pointer to created array object
+ */
+jerry_api_object_t*
+jerry_api_create_array_object (jerry_api_length_t length, /**< length of the array */
+                               jerry_array_element_get_t get_p, /**< callback returning the elements */
+                               void *user_data_p) /**< data passed to the callback */
+{
+  jerry_assert_api_available ();
+
+  ecma_number_t *length_num_p = ecma_alloc_number ();
+  *length_num_p = ecma_uint32_to_number (length);
+  ecma_value_t length_value = ecma_make_number_value (length_num_p);
+
+  ecma_completion_value_t array_completion = ecma_op_create_array_object (&length_value, 1, true);
+  JERRY_ASSERT (ecma_is_completion_value_normal (array_completion));
+
+  ecma_dealloc_number (length_num_p);
+
+  ecma_object_t *array_obj_p = ecma_get_object_from_completion_value (array_completion);
+
+  for (jerry_api_length_t index = 0; index < length; index++)
+  {
+    jerry_api_value_t element_api_value;
+    get_p (index, &element_api_value, user_data_p);
+
+    ecma_string_t *index_string_p = ecma_new_ecma_string_from_uint32 (index);
+    jerry_api_add_new_data_property (array_obj_p, index_string_p, &element_api_value);
+    ecma_deref_ecma_string (index_string_p);
+  }
+
+  return array_obj_p;
+} /* jerry_api_create_array_object */
+
+/**
+ * Create an object and fill it with fields returned by the callback
+ *
+ * Like jerry_api_create_array_object, the fields are stored as data properties directly.
+ *
+ * Note:
+ *      names of the fields must be distinct;
+ *      caller should release the object with jerry_api_release_object, just when the value becomes unnecessary.
+ *
+ * @return pointer to created object
+ */
+jerry_api_object_t*
+jerry_api_create_object_with_fields (jerry_api_length_t fields_count, /**< number of fields */
+                                     jerry_object_field_get_t get_p, /**< callback returning the fields */
+                                     void *user_data_p) /**< data passed to the callback */
+{
+  jerry_assert_api_available ();
+
+  ecma_object_t *obj_p = ecma_op_create_object_object_noarg ();
+
+  for (jerry_api_length_t index = 0; index < fields_count; index++)
+  {
+    jerry_api_string_t *field_name_p;
+    jerry_api_value_t field_value;
+    get_p (index, &field_name_p, &field_value, user_data_p);
+
+    jerry_api_add_new_data_property (obj_p, field_name_p, &field_value);
+    ecma_deref_ecma_string (field_name_p);
+  }
+
+  return obj_p;
+} /* jerry_api_create_object_with_fields */
+
 /**
  * Create an error object
  *
@@ -772,7 +872,7 @@ bool jerry_api_get_object_field_value (jerry_api_object_t *object_p,
 }
 
 /**
- * Get value of field in the specified object
+ * Get value of field in the specified object, using an already created string as the field name
  *
  * Note:
  *      if value was retrieved successfully, it should be freed
@@ -783,21 +883,17 @@ bool jerry_api_get_object_field_value (jerry_api_object_t *object_p,
  *         false - otherwise.
  */
 bool
-jerry_api_get_object_field_value_sz (jerry_api_object_t *object_p, /**< object */
-                                     const jerry_api_char_t *field_name_p, /**< name of the field */
-                                     jerry_api_size_t field_name_size, /**< size of field name in bytes */
-                                     jerry_api_value_t *field_value_p) /**< out: field value, if retrieved
+jerry_api_get_object_field_value_by_string (jerry_api_object_t *object_p, /**< object */
+                                            jerry_api_string_t *field_name_p, /**< name of the field */
+                                            jerry_api_value_t *field_value_p) /**< out: field value, if retrieved
  * successfully */
 {
   jerry_assert_api_available ();
 
   bool is_successful = true;
 
-  ecma_string_t* field_name_str_p = ecma_new_ecma_string_from_utf8 ((lit_utf8_byte_t *) field_name_p,
-                                                                    (lit_utf8_size_t) field_name_size);
-
   ecma_completion_value_t get_completion = ecma_op_object_get (object_p,
-                                                               field_name_str_p);
+                                                               field_name_p);
 
   if (ecma_is_completion_value_normal (get_completion))
   {
@@ -814,6 +910,34 @@ jerry_api_get_object_field_value_sz (jerry_api_object_t *object_p, /**< object *
 
   ecma_free_completion_value (get_completion);
 
+  return is_successful;
+} /* jerry_api_get_object_field_value_by_string */
+
+/**
+ * Get value of field in the specified object
+ *
+ * Note:
+ *      if value was retrieved successfully, it should be freed
+ *      with jerry_api_release_value just when it becomes unnecessary.
+ *
+ * @return true, if field value was retrieved successfully, i.e. upon the call:
+ *                - there is field with specified name in the object;
+ *         false - otherwise.
+ */
+bool
+jerry_api_get_object_field_value_sz (jerry_api_object_t *object_p, /**< object */
+                                     const jerry_api_char_t *field_name_p, /**< name of the field */
+                                     jerry_api_size_t field_name_size, /**< size of field name in bytes */
+                                     jerry_api_value_t *field_value_p) /**< out: field value, if retrieved
+ * successfully */
+{
+  jerry_assert_api_available ();
+
+  ecma_string_t* field_name_str_p = ecma_new_ecma_string_from_utf8 ((lit_utf8_byte_t *) field_name_p,
+                                                                    (lit_utf8_size_t) field_name_size);
+
+  bool is_successful = jerry_api_get_object_field_value_by_string (object_p, field_name_str_p, field_value_p);
+
   ecma_deref_ecma_string (field_name_str_p);
 
   return is_successful;
@@ -838,30 +962,26 @@ jerry_api_set_object_field_value (jerry_api_object_t *object_p, /**< object */
 }
 
 /**
- * Set value of field in the specified object
+ * Set value of field in the specified object, using an already created string as the field name
  *
  * @return true, if field value was set successfully, i.e. upon the call:
  *                - field value is writable;
  *         false - otherwise.
  */
 bool
-jerry_api_set_object_field_value_sz (jerry_api_object_t *object_p, /**< object */
-                                     const jerry_api_char_t *field_name_p, /**< name of the field */
-                                     jerry_api_size_t field_name_size, /**< size of field name in bytes */
-                                     const jerry_api_value_t *field_value_p) /**< field value to set */
+jerry_api_set_object_field_value_by_string (jerry_api_object_t *object_p, /**< object */
+                                            jerry_api_string_t *field_name_p, /**< name of the field */
+                                            const jerry_api_value_t *field_value_p) /**< field value to set */
 {
   jerry_assert_api_available ();
 
   bool is_successful = true;
 
-  ecma_string_t* field_name_str_p = ecma_new_ecma_string_from_utf8 ((lit_utf8_byte_t *) field_name_p,
-                                                                    (lit_utf8_size_t) field_name_size);
-
   ecma_value_t value_to_put;
   jerry_api_convert_api_value_to_ecma_value (&value_to_put, field_value_p);
 
   ecma_completion_value_t set_completion = ecma_op_object_put (object_p,
-                                                               field_name_str_p,
+                                                               field_name_p,
                                                                value_to_put,
                                                                true);
 
@@ -875,10 +995,281 @@ jerry_api_set_object_field_value_sz (jerry_api_object_t *object_p, /**< object *
   ecma_free_completion_value (set_completion);
 
   ecma_free_value (value_to_put, true);
+
+  return is_successful;
+} /* jerry_api_set_object_field_value_by_string */
+
+/**
+ * Set value of field in the specified object
+ *
+ * @return true, if field value was set successfully, i.e. upon the call:
+ *                - field value is writable;
+ *         false - otherwise.
+ */
+bool
+jerry_api_set_object_field_value_sz (jerry_api_object_t *object_p, /**< object */
+                                     const jerry_api_char_t *field_name_p, /**< name of the field */
+                                     jerry_api_size_t field_name_size, /**< size of field name in bytes */
+                                     const jerry_api_value_t *field_value_p) /**< field value to set */
+{
+  jerry_assert_api_available ();
+
+  ecma_string_t* field_name_str_p = ecma_new_ecma_string_from_utf8 ((lit_utf8_byte_t *) field_name_p,
+                                                                    (lit_utf8_size_t) field_name_size);
+
+  bool is_successful = jerry_api_set_object_field_value_by_string (object_p, field_name_str_p, field_value_p);
+
   ecma_deref_ecma_string (field_name_str_p);
 
   return is_successful;
-} /* jerry_api_set_object_field_value */
+} /* jerry_api_set_object_field_value_sz */
+
+/**
+ * Set values of several fields in the specified object
+ *
+ * Note:
+ *      fields are set in order; setting stops at the first field that could not be set.
+ *
+ * @return true, if all field values were set successfully;
+ *         false - otherwise.
+ */
+bool
+jerry_api_set_object_field_values (jerry_api_object_t *object_p, /**< object */
+                                   jerry_api_string_t *const *field_names_p, /**< names of the fields */
+                                   const jerry_api_value_t *field_values_p, /**< field values to set */
+                                   jerry_api_length_t fields_count) /**< number of fields */
+{
+  jerry_assert_api_available ();
+
+  for (jerry_api_length_t i = 0; i < fields_count; i++)
+  {
+    if (!jerry_api_set_object_field_value_by_string (object_p, field_names_p[i], field_values_p + i))
+    {
+      return false;
+    }
+  }
+
+  return true;
+} /* jerry_api_set_object_field_values */
+
+/**
+ * Iterate over names of own enumerable fields of the specified object
+ *
+ * The object's property list is walked directly, so no collection of names is built.
+ * Values are not read, so getters of accessor properties are not called.
+ *
+ * Note:
+ *      properties of the object must not be added or deleted from the callback.
+ *
+ * @return true, if all field names were iterated;
+ *         false - if the callback stopped iteration.
+ */
+bool
+jerry_api_foreach_object_field_name (jerry_api_object_t *object_p, /**< object */
+                                     jerry_object_field_name_foreach_t foreach_p, /**< callback */
+                                     void *user_data_p) /**< data passed to the callback */
+{
+  jerry_assert_api_available ();
+
+  for (ecma_property_t *prop_iter_p = ecma_get_property_list (object_p);
+       prop_iter_p != NULL;
+       prop_iter_p = ECMA_GET_POINTER (ecma_property_t, prop_iter_p->next_property_p))
+  {
+    if (prop_iter_p->type == ECMA_PROPERTY_INTERNAL
+        || !ecma_is_property_enumerable (prop_iter_p))
+    {
+      continue;
+    }
+
+    ecma_string_t *field_name_p;
+
+    if (prop_iter_p->type == ECMA_PROPERTY_NAMEDDATA)
+    {
+      field_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, prop_iter_p->u.named_data_property.name_p);
+    }
+    else
+    {
+      JERRY_ASSERT (prop_iter_p->type == ECMA_PROPERTY_NAMEDACCESSOR);
+
+      field_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, prop_iter_p->u.named_accessor_property.name_p);
+    }
+
+    if (!foreach_p (field_name_p, user_data_p))
+    {
+      return false;
+    }
+  }
+
+  return true;
+} /* jerry_api_foreach_object_field_name */
+
+/**
+ * Iterate over own enumerable fields of the specified object
+ *
+ * Names of the fields are collected first, as getters of accessor properties and the callback
+ * may change the object. Fields that are deleted or made non-enumerable before they are reached
+ * are skipped.
+ *
+ * @return true, if all fields were iterated;
+ *         false - if the callback stopped iteration or a getter threw an exception.
+ */
+bool
+jerry_api_foreach_object_field (jerry_api_object_t *object_p, /**< object */
+                                jerry_object_field_foreach_t foreach_p, /**< callback */
+                                void *user_data_p) /**< data passed to the callback */
+{
+  jerry_assert_api_available ();
+
+  ecma_collection_header_t *field_names_p = ecma_new_values_collection (NULL, 0, false);
+
+  for (ecma_property_t *prop_iter_p = ecma_get_property_list (object_p);
+       prop_iter_p != NULL;
+       prop_iter_p = ECMA_GET_POINTER (ecma_property_t, prop_iter_p->next_property_p))
+  {
+    if (prop_iter_p->type == ECMA_PROPERTY_NAMEDDATA && ecma_is_property_enumerable (prop_iter_p))
+    {
+      ecma_string_t *field_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t,
+                                                               prop_iter_p->u.named_data_property.name_p);
+      ecma_append_to_values_collection (field_names_p, ecma_make_string_value (field_name_p), false);
+    }
+    else if (prop_iter_p->type == ECMA_PROPERTY_NAMEDACCESSOR && ecma_is_property_enumerable (prop_iter_p))
+    {
+      ecma_string_t *field_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t,
+                                                               prop_iter_p->u.named_accessor_property.name_p);
+      ecma_append_to_values_collection (field_names_p, ecma_make_string_value (field_name_p), false);
+    }
+  }
+
+  bool is_complete = true;
+
+  ecma_collection_iterator_t names_iterator;
+  ecma_collection_iterator_init (&names_iterator, field_names_p);
+
+  while (is_complete && ecma_collection_iterator_next (&names_iterator))
+  {
+    ecma_string_t *field_name_p = ecma_get_string_from_value (*names_iterator.current_value_p);
+    ecma_property_t *prop_p = ecma_find_named_property (object_p, field_name_p);
+
+    if (prop_p == NULL || !ecma_is_property_enumerable (prop_p))
+    {
+      continue;
+    }
+
+    ecma_completion_value_t get_completion = ecma_op_object_get (object_p, field_name_p);
+
+    if (!ecma_is_completion_value_normal (get_completion))
+    {
+      JERRY_ASSERT (ecma_is_completion_value_throw (get_completion));
+
+      is_complete = false;
+    }
+    else
+    {
+      jerry_api_value_t field_value;
+      jerry_api_convert_ecma_value_to_api_value (&field_value, ecma_get_completion_value_value (get_completion));
+
+      is_complete = foreach_p (field_name_p, &field_value, user_data_p);
+
+      jerry_api_release_value (&field_value);
+    }
+
+    ecma_free_completion_value (get_completion);
+  }
+
+  ecma_free_values_collection (field_names_p, false);
+
+  return is_complete;
+} /* jerry_api_foreach_object_field */
+
+/**
+ * Get length of an array or an array-like object
+ *
+ * @return value of the object's 'length' property converted with ToUint32,
+ *         0 - if the property is not a number or its getter threw an exception.
+ */
+jerry_api_length_t
+jerry_api_get_array_length (jerry_api_object_t *object_p) /**< object */
+{
+  jerry_assert_api_available ();
+
+  ecma_string_t *length_magic_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
+  ecma_completion_value_t get_completion = ecma_op_object_get (object_p, length_magic_string_p);
+  ecma_deref_ecma_string (length_magic_string_p);
+
+  jerry_api_length_t length = 0;
+
+  if (ecma_is_completion_value_normal (get_completion))
+  {
+    ecma_value_t length_value = ecma_get_completion_value_value (get_completion);
+
+    if (ecma_is_value_number (length_value))
+    {
+      length = ecma_number_to_uint32 (*ecma_get_number_from_value (length_value));
+    }
+  }
+
+  ecma_free_completion_value (get_completion);
+
+  return length;
+} /* jerry_api_get_array_length */
+
+/**
+ * Iterate over elements of an array or an array-like object, from index 0 to its length
+ *
+ * Missing elements are looked up in the prototype chain like with a property access,
+ * so holes are passed as undefined values.
+ *
+ * Note:
+ *      every element that exists takes at least a pool chunk, so no more elements are iterated
+ *      than the heap could hold; a forged length of an array-like object cannot make
+ *      the iteration run over billions of holes
+ *
+ * @return true, if all elements were iterated;
+ *         false - if the callback stopped iteration or a getter threw an exception.
+ */
+bool
+jerry_api_foreach_array_element (jerry_api_object_t *object_p, /**< object */
+                                 jerry_array_element_foreach_t foreach_p, /**< callback */
+                                 void *user_data_p) /**< data passed to the callback */
+{
+  jerry_assert_api_available ();
+
+  const size_t max_length = mem_heap_get_size () / MEM_POOL_CHUNK_SIZE;
+  const jerry_api_length_t length = (jerry_api_length_t) JERRY_MIN (jerry_api_get_array_length (object_p),
+                                                                    max_length);
+
+  for (jerry_api_length_t index = 0; index < length; index++)
+  {
+    ecma_string_t *index_string_p = ecma_new_ecma_string_from_uint32 (index);
+    ecma_completion_value_t get_completion = ecma_op_object_get (object_p, index_string_p);
+    ecma_deref_ecma_string (index_string_p);
+
+    if (!ecma_is_completion_value_normal (get_completion))
+    {
+      JERRY_ASSERT (ecma_is_completion_value_throw (get_completion));
+
+      ecma_free_completion_value (get_completion);
+
+      return false;
+    }
+
+    jerry_api_value_t element_value;
+    jerry_api_convert_ecma_value_to_api_value (&element_value, ecma_get_completion_value_value (get_completion));
+
+    ecma_free_completion_value (get_completion);
+
+    const bool is_continue = foreach_p (index, &element_value, user_data_p);
+
+    jerry_api_release_value (&element_value);
+
+    if (!is_continue)
+    {
+      return false;
+    }
+  }
+
+  return true;
+} /* jerry_api_foreach_array_element */
 
 /**
  * Get native handle, associated with specified object
@@ -945,6 +1336,20 @@ jerry_api_set_object_native_handle (jerry_api_object_t *object_p, /**< object to
   }
 } /* jerry_api_set_object_native_handle */
 
+/**
+ * Run garbage collection
+ *
+ * Note:
+ *      free callbacks of collected objects are called before return.
+ */
+void
+jerry_api_gc (void)
+{
+  jerry_assert_api_available ();
+
+  ecma_gc_run ();
+} /* jerry_api_gc */
+
 /**
  * Invoke function specified by a function object
  *
@@ -1161,31 +1566,16 @@ jerry_api_get_global (void)
 } /* jerry_api_get_global */
 
 /**
- * Perform eval
+ * Convert completion of eval code to API completion code and value, and free the completion
  *
- * Note:
- *      If current code is executed on top of interpreter, using is_direct argument,
- *      caller can enable direct eval mode that is equivalent to calling eval from
- *      within of current JS execution context.
- *
- * @return completion status
+ * @return completion code
  */
-jerry_completion_code_t
-jerry_api_eval (const jerry_api_char_t *source_p, /**< source code */
-                size_t source_size, /**< length of source code */
-                bool is_direct, /**< perform eval invocation in direct mode */
-                bool is_strict, /**< perform eval as it is called from strict mode code */
-                jerry_api_value_t *retval_p) /**< out: returned value */
+static jerry_completion_code_t
+jerry_api_convert_eval_completion (ecma_completion_value_t completion, /**< completion of eval code */
+                                   jerry_api_value_t *retval_p) /**< out: returned value */
 {
-  jerry_assert_api_available ();
-
   jerry_completion_code_t status;
 
-  ecma_completion_value_t completion = ecma_op_eval_chars_buffer ((const lit_utf8_byte_t *) source_p,
-                                                                  source_size,
-                                                                  is_direct,
-                                                                  is_strict);
-
   if (ecma_is_completion_value_normal (completion))
   {
     status = JERRY_COMPLETION_CODE_OK;
@@ -1212,13 +1602,162 @@ jerry_api_eval (const jerry_api_char_t *source_p, /**< source code */
   ecma_free_completion_value (completion);
 
   return status;
+} /* jerry_api_convert_eval_completion */
+
+/**
+ * Perform eval
+ *
+ * Note:
+ *      If current code is executed on top of interpreter, using is_direct argument,
+ *      caller can enable direct eval mode that is equivalent to calling eval from
+ *      within of current JS execution context.
+ *
+ * @return completion status
+ */
+jerry_completion_code_t
+jerry_api_eval (const jerry_api_char_t *source_p, /**< source code */
+                size_t source_size, /**< length of source code */
+                bool is_direct, /**< perform eval invocation in direct mode */
+                bool is_strict, /**< perform eval as it is called from strict mode code */
+                jerry_api_value_t *retval_p) /**< out: returned value */
+{
+  jerry_assert_api_available ();
+
+  ecma_completion_value_t completion = ecma_op_eval_chars_buffer ((const lit_utf8_byte_t *) source_p,
+                                                                  source_size,
+                                                                  is_direct,
+                                                                  is_strict);
+
+  return jerry_api_convert_eval_completion (completion, retval_p);
 } /* jerry_api_eval */
 
+/**
+ * Compile source code once, so that it can be run many times with jerry_api_run_script
+ *
+ * Note:
+ *      the source is compiled as indirect, non-strict eval code
+ *
+ * Warning:
+ *         the compiled script should be released with jerry_api_release_script
+ *
+ * @return true - if the source was compiled successfully (no SyntaxError or early ReferenceError),
+ *         false - otherwise.
+ */
+bool
+jerry_api_compile (const jerry_api_char_t *source_p, /**< source code */
+                   size_t source_size, /**< length of source code */
+                   const jerry_api_script_t **out_script_p) /**< out: compiled script */
+{
+  jerry_assert_api_available ();
+
+  const vm_instr_t *instrs_p;
+  jsp_status_t parse_status = parser_parse_eval (source_p, source_size, false, &instrs_p);
+
+  if (parse_status != JSP_STATUS_OK)
+  {
+    *out_script_p = NULL;
+
+    return false;
+  }
+
+  *out_script_p = instrs_p;
+
+  return true;
+} /* jerry_api_compile */
+
+/**
+ * Acquire another reference to a script compiled with jerry_api_compile
+ *
+ * Warning:
+ *         acquired script should be released with jerry_api_release_script
+ *
+ * @return the script
+ */
+const jerry_api_script_t*
+jerry_api_acquire_script (const jerry_api_script_t *script_p) /**< compiled script */
+{
+  jerry_assert_api_available ();
+
+  serializer_acquire_bytecode (script_p);
+
+  return script_p;
+} /* jerry_api_acquire_script */
+
+/**
+ * Release a compiled script
+ *
+ * Note:
+ *      the byte-code is freed once functions that were created by the script are collected as well
+ *
+ * See also:
+ *          jerry_api_compile
+ *          jerry_api_acquire_script
+ */
+void
+jerry_api_release_script (const jerry_api_script_t *script_p) /**< compiled script */
+{
+  jerry_assert_api_available ();
+
+  serializer_release_bytecode (script_p);
+} /* jerry_api_release_script */
+
+/**
+ * Run script compiled with jerry_api_compile
+ *
+ * @return completion code
+ */
+jerry_completion_code_t
+jerry_api_run_script (const jerry_api_script_t *script_p, /**< compiled script */
+                      jerry_api_value_t *retval_p) /**< out: returned value */
+{
+  jerry_assert_api_available ();
+
+  JERRY_ASSERT (script_p != NULL);
+
+  ecma_completion_value_t completion = ecma_op_eval_instrs (script_p, false, false);
+
+  return jerry_api_convert_eval_completion (completion, retval_p);
+} /* jerry_api_run_script */
+
+/**
+ * Save script compiled with jerry_api_compile to a snapshot
+ *
+ * Note:
+ *      nothing is written if the buffer is too small
+ *
+ * @return size of the snapshot (required size of the buffer)
+ */
+size_t
+jerry_api_save_snapshot (const jerry_api_script_t *script_p, /**< compiled script */
+                         uint8_t *buffer_p, /**< buffer to save snapshot to */
+                         size_t buffer_size) /**< size of the buffer */
+{
+  jerry_assert_api_available ();
+
+  JERRY_ASSERT (script_p != NULL);
+
+  return serializer_save_snapshot (script_p, buffer_p, buffer_size);
+} /* jerry_api_save_snapshot */
+
 /**
  * Jerry engine initialization
  */
 void
 jerry_init (jerry_flag_t flags) /**< combination of Jerry flags */
+{
+  jerry_init_with_heap_size (flags, 0);
+} /* jerry_init */
+
+/**
+ * Jerry engine initialization with specified heap size
+ *
+ * Note:
+ *      the size is rounded down to a multiple of the heap chunk size,
+ *      and sizes above 2 ^ CONFIG_MEM_HEAP_OFFSET_LOG are reduced to it
+ */
+void
+jerry_init_with_heap_size (jerry_flag_t flags, /**< combination of Jerry flags */
+                           size_t heap_size) /**< heap size in bytes (0 - default size) */
 {
   if (flags & (JERRY_FLAG_ENABLE_LOG))
   {
@@ -1245,14 +1784,27 @@ jerry_init (jerry_flag_t flags) /**< combination of Jerry flags */
       "Ignoring detailed memory statistics options because memory statistics dump mode is not enabled.\n");
   }
 
+  if (heap_size == 0)
+  {
+    heap_size = MEM_HEAP_AREA_SIZE;
+  }
+  else if (heap_size > MEM_HEAP_MAX_AREA_SIZE)
+  {
+    heap_size = MEM_HEAP_MAX_AREA_SIZE;
+
+    JERRY_WARNING_MSG ("Reducing heap size to the maximum of 'CONFIG_MEM_HEAP_OFFSET_LOG' build configuration.\n");
+  }
+
+  heap_size = JERRY_MAX (JERRY_ALIGNDOWN (heap_size, MEM_HEAP_CHUNK_SIZE), MEM_HEAP_CHUNK_SIZE);
+
   jerry_flags = flags;
 
   jerry_make_api_available ();
 
-  mem_init ();
+  mem_init (heap_size);
   serializer_init ();
   ecma_init ();
-} /* jerry_init */
+} /* jerry_init_with_heap_size */
 
 /**
  * Terminate Jerry engine
@@ -1394,18 +1946,118 @@ jerry_run_simple (const jerry_api_char_t *script_source, /**< script source */
   return ret_code;
 } /* jerry_run_simple */
 
+/**
+ * Parse script and save its byte-code with the referenced literals to a snapshot
+ *
+ * The snapshot contains no pointers, so it can be stored in a file and later executed
+ * with jerry_exec_snapshot by an engine built with the same configuration.
+ *
+ * @return size of the snapshot - if the script was parsed and the snapshot fits into the buffer,
+ *         0 - otherwise.
+ */
+size_t
+jerry_parse_and_save_snapshot (const jerry_api_char_t *source_p, /**< script source */
+                               size_t source_size, /**< script source size */
+                               uint8_t *buffer_p, /**< buffer to save snapshot to */
+                               size_t buffer_size) /**< size of the buffer */
+{
+  jerry_assert_api_available ();
+
+  const vm_instr_t *instrs_p;
+  jsp_status_t parse_status = parser_parse_eval (source_p, source_size, false, &instrs_p);
+
+  if (parse_status != JSP_STATUS_OK)
+  {
+    return 0;
+  }
+
+  const size_t snapshot_size = serializer_save_snapshot (instrs_p, buffer_p, buffer_size);
+
+  serializer_release_bytecode (instrs_p);
+
+  return (snapshot_size <= buffer_size) ? snapshot_size : 0;
+} /* jerry_parse_and_save_snapshot */
+
+/**
+ * Execute snapshot created with jerry_parse_and_save_snapshot
+ *
+ * The script is not parsed again: literals are registered directly from the snapshot and
+ * the byte-code is copied into the engine's heap, so the snapshot buffer (for example,
+ * a memory-mapped file) is not referenced after the call returns. The copy is freed after
+ * the run, or once functions that were created by the script are collected.
+ *
+ * @return completion code
+ */
+jerry_completion_code_t
+jerry_exec_snapshot (const void *snapshot_p, /**< snapshot */
+                     size_t snapshot_size, /**< size of the snapshot */
+                     jerry_api_value_t *retval_p) /**< out: returned value */
+{
+  jerry_assert_api_available ();
+
+  const vm_instr_t *instrs_p = serializer_load_snapshot ((const uint8_t *) snapshot_p, snapshot_size);
+
+  if (instrs_p == NULL)
+  {
+    retval_p->type = JERRY_API_DATA_TYPE_UNDEFINED;
+
+    return JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_FORMAT;
+  }
+
+  jerry_completion_code_t ret_code = jerry_api_run_script (instrs_p, retval_p);
+
+  serializer_release_bytecode (instrs_p);
+
+  return ret_code;
+} /* jerry_exec_snapshot */
+
 #ifdef CONFIG_JERRY_ENABLE_CONTEXTS
+/**
+ * Run context descriptor
+ *
+ * Engine state is thread-local (see JERRY_THREAD_LOCAL), so a run context is the engine instance
+ * of the thread that allocated it. Engine instances of different threads share nothing
+ * and can run in parallel.
+ */
+struct jerry_ctx_t
+{
+  uint32_t push_count; /**< number of times the context is currently pushed */
+};
+
+/**
+ * Run context of the calling thread
+ */
+static JERRY_THREAD_LOCAL jerry_ctx_t jerry_thread_ctx;
+
+/**
+ * Flag indicating whether the run context of the calling thread is allocated
+ */
+static JERRY_THREAD_LOCAL bool jerry_thread_ctx_is_allocated = false;
+
 /**
  * Allocate new run context
  *
- * @return run context
+ * Note:
+ *      there is one engine instance per thread, so only one context can be allocated on a thread;
+ *      a second context would share the heap of the first one, so it is refused
+ *
+ * @return run context - if the calling thread has no allocated context,
+ *         NULL - otherwise
  */
 jerry_ctx_t*
 jerry_new_ctx (void)
 {
   jerry_assert_api_available ();
 
-  JERRY_UNIMPLEMENTED ("Run contexts are not implemented");
+  if (jerry_thread_ctx_is_allocated)
+  {
+    return NULL;
+  }
+
+  jerry_thread_ctx_is_allocated = true;
+  jerry_thread_ctx.push_count = 0;
+
+  return &jerry_thread_ctx;
 } /* jerry_new_ctx */
 
 /**
@@ -1416,18 +2068,26 @@ jerry_cleanup_ctx (jerry_ctx_t* ctx_p) /**< run context */
 {
   jerry_assert_api_available ();
 
-  JERRY_UNIMPLEMENTED_REF_UNUSED_VARS ("Run contexts are not implemented", ctx_p);
+  JERRY_ASSERT (ctx_p == &jerry_thread_ctx && jerry_thread_ctx_is_allocated);
+  JERRY_ASSERT (ctx_p->push_count == 0);
+
+  jerry_thread_ctx_is_allocated = false;
 } /* jerry_cleanup_ctx */
 
 /**
  * Activate context and push it to contexts' stack
+ *
+ * Note:
+ *      a context can only be activated on the thread that allocated it
  */
 void
 jerry_push_ctx (jerry_ctx_t *ctx_p) /**< run context */
 {
   jerry_assert_api_available ();
 
-  JERRY_UNIMPLEMENTED_REF_UNUSED_VARS ("Run contexts are not implemented", ctx_p);
+  JERRY_ASSERT (ctx_p == &jerry_thread_ctx && jerry_thread_ctx_is_allocated);
+
+  ctx_p->push_count++;
 } /* jerry_push_ctx */
 
 /**
@@ -1441,7 +2101,9 @@ jerry_pop_ctx (void)
 {
   jerry_assert_api_available ();
 
-  JERRY_UNIMPLEMENTED ("Run contexts are not implemented");
+  JERRY_ASSERT (jerry_thread_ctx_is_allocated && jerry_thread_ctx.push_count > 0);
+
+  jerry_thread_ctx.push_count--;
 } /* jerry_pop_ctx */
 #endif /* CONFIG_JERRY_ENABLE_CONTEXTS */
 
@@ -79,6 +79,7 @@ extern FILE *jerry_log_file;
 typedef void (*jerry_error_callback_t) (jerry_fatal_code_t);
 
 extern EXTERN_C void jerry_init (jerry_flag_t flags);
+extern EXTERN_C void jerry_init_with_heap_size (jerry_flag_t flags, size_t heap_size);
 extern EXTERN_C void jerry_cleanup (void);
 
 extern EXTERN_C void jerry_get_memory_limits (size_t *out_data_bss_brk_limit_p, size_t *out_stack_limit_p);
@@ -92,6 +93,16 @@ jerry_run_simple (const jerry_api_char_t *script_source,
                   size_t script_source_size,
                   jerry_flag_t flags);
 
+extern EXTERN_C size_t
+jerry_parse_and_save_snapshot (const jerry_api_char_t *source_p,
+                               size_t source_size,
+                               uint8_t *buffer_p,
+                               size_t buffer_size);
+extern EXTERN_C jerry_completion_code_t
+jerry_exec_snapshot (const void *snapshot_p,
+                     size_t snapshot_size,
+                     jerry_api_value_t *retval_p);
+
 #ifdef CONFIG_JERRY_ENABLE_CONTEXTS
 /** \addtogroup jerry Jerry run contexts-related interface
  * @{
@@ -39,6 +39,18 @@
 # define __attr_pure___ __attribute__((pure))
 #endif /* !__attr_pure___ */
 
+/**
+ * Storage class of engine state
+ *
+ * With run contexts enabled every thread runs an engine instance of its own,
+ * so variables holding engine state are thread-local.
+ */
+#ifdef CONFIG_JERRY_ENABLE_CONTEXTS
+# define JERRY_THREAD_LOCAL thread_local
+#else /* !CONFIG_JERRY_ENABLE_CONTEXTS */
+# define JERRY_THREAD_LOCAL
+#endif /* !CONFIG_JERRY_ENABLE_CONTEXTS */
+
 /**
  * Constants
  */
@@ -23,7 +23,7 @@
  * As our libc library doesn't call constructors of static variables, lit_storage is initialized
  * in lit_init function by placement new operator.
  */
-lit_literal_storage_t lit_storage;
+JERRY_THREAD_LOCAL lit_literal_storage_t lit_storage;
 
 /**
  * Get pointer to the previous record inside the literal storage
@@ -37,7 +37,7 @@ lit_charset_record_t::get_prev () const
   it.skip (RCS_DYN_STORAGE_LENGTH_UNIT);
 
   cpointer_t cpointer;
-  cpointer.packed_value = it.read<uint16_t> ();
+  cpointer.packed_value = it.read<mem_cpointer_t> ();
 
   return cpointer_t::decompress (cpointer);
 } /* lit_charset_record_t::get_prev */
@@ -51,7 +51,7 @@ lit_charset_record_t::set_prev (rcs_record_t *prev_rec_p) /**< pointer to the re
   rcs_record_iterator_t it ((rcs_recordset_t *)&lit_storage, (rcs_record_t *)this);
   it.skip (RCS_DYN_STORAGE_LENGTH_UNIT);
 
-  it.write<uint16_t> (cpointer_t::compress (prev_rec_p).packed_value);
+  it.write<mem_cpointer_t> (cpointer_t::compress (prev_rec_p).packed_value);
 } /* lit_charset_record_t::set_prev */
 
 /**
@@ -466,8 +466,8 @@ template uint8_t rcs_record_iterator_t::read<uint8_t> ();
 template void rcs_record_iterator_t::write<ecma_number_t> (ecma_number_t);
 template ecma_number_t rcs_record_iterator_t::read<ecma_number_t> ();
 
-template void rcs_record_iterator_t::write<uint16_t> (uint16_t);
-template uint16_t rcs_record_iterator_t::read<uint16_t> ();
+template void rcs_record_iterator_t::write<mem_cpointer_t> (mem_cpointer_t);
+template mem_cpointer_t rcs_record_iterator_t::read<mem_cpointer_t> ();
 
 template lit_magic_string_id_t lit_magic_record_t::get_magic_str_id<lit_magic_string_id_t>() const;
 template lit_magic_string_ex_id_t lit_magic_record_t::get_magic_str_id<lit_magic_string_ex_id_t>() const;
@@ -20,7 +20,7 @@
 #include "rcs-recordset.h"
 
 class lit_literal_storage_t;
-extern lit_literal_storage_t lit_storage;
+extern JERRY_THREAD_LOCAL lit_literal_storage_t lit_storage;
 
 /**
  * Charset record
@@ -162,7 +162,7 @@ private:
    * Offset and length of 'alignment' field, in bits
    */
   static const uint32_t _alignment_field_pos = _fields_offset_begin;
-  static const uint32_t _alignment_field_width = 2u;
+  static const uint32_t _alignment_field_width = RCS_DYN_STORAGE_ALIGNMENT_LOG;
 
   /**
    * Offset and length of 'hash' field, in bits
@@ -182,7 +182,7 @@ private:
   static const uint32_t _prev_field_pos = _length_field_pos + _length_field_width;
   static const uint32_t _prev_field_width = rcs_cpointer_t::bit_field_width;
 
-  static const size_t _header_size = RCS_DYN_STORAGE_LENGTH_UNIT + RCS_DYN_STORAGE_LENGTH_UNIT / 2;
+  static const size_t _header_size = RCS_DYN_STORAGE_LENGTH_UNIT + sizeof (mem_cpointer_t);
 }; /* lit_charset_record_t */
 
 /**
@@ -394,7 +394,7 @@ private:
   static const uint32_t prev_field_width = rcs_cpointer_t::bit_field_width;
 
   static const size_t _header_size = RCS_DYN_STORAGE_LENGTH_UNIT;
-  static const size_t _size = _header_size + sizeof (ecma_number_t);
+  static const size_t _size = JERRY_ALIGNUP (_header_size + sizeof (ecma_number_t), RCS_DYN_STORAGE_LENGTH_UNIT);
 }; /* lit_number_record_t */
 
 /**
@@ -514,7 +514,7 @@ lit_literal_to_utf8_string (literal_t lit, /**< literal to be processed */
 const char *
 lit_literal_to_str_internal_buf (literal_t lit) /**< literal */
 {
-  static lit_utf8_byte_t buff[ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER + 1];
+  static JERRY_THREAD_LOCAL lit_utf8_byte_t buff[ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER + 1];
   memset (buff, 0, sizeof (buff));
 
   return (const char *) lit_literal_to_utf8_string (lit, buff, sizeof (buff) - 1);
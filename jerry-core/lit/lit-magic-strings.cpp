@@ -20,20 +20,20 @@
 /**
  * Lengths of magic strings
  */
-static lit_utf8_size_t lit_magic_string_sizes[LIT_MAGIC_STRING__COUNT];
+static JERRY_THREAD_LOCAL lit_utf8_size_t lit_magic_string_sizes[LIT_MAGIC_STRING__COUNT];
 
 /**
  * External magic strings data array, count and lengths
  */
-static const lit_utf8_byte_t **lit_magic_string_ex_array = NULL;
-static uint32_t lit_magic_string_ex_count = 0;
-static const lit_utf8_size_t *lit_magic_string_ex_sizes = NULL;
+static JERRY_THREAD_LOCAL const lit_utf8_byte_t **lit_magic_string_ex_array = NULL;
+static JERRY_THREAD_LOCAL uint32_t lit_magic_string_ex_count = 0;
+static JERRY_THREAD_LOCAL const lit_utf8_size_t *lit_magic_string_ex_sizes = NULL;
 
 #ifndef JERRY_NDEBUG
 /**
  * Maximum length among lengths of magic strings
  */
-static ecma_length_t ecma_magic_string_max_length;
+static JERRY_THREAD_LOCAL ecma_length_t ecma_magic_string_max_length;
 #endif /* JERRY_NDEBUG */
 
 /**
@@ -28,24 +28,52 @@
 #include "mem-allocator-internal.h"
 
 /**
- * Area for heap
+ * Area for heap, aligned inside of the block allocated for it
  */
-static uint8_t mem_heap_area[ MEM_HEAP_AREA_SIZE ] __attribute__ ((aligned (JERRY_MAX (MEM_ALIGNMENT,
-                                                                                       MEM_HEAP_CHUNK_SIZE))));
+static JERRY_THREAD_LOCAL uint8_t *mem_heap_area = NULL;
+
+/**
+ * Block allocated for the heap area
+ */
+static JERRY_THREAD_LOCAL void *mem_heap_area_block_p = NULL;
+
+/**
+ * Size of heap area
+ */
+static JERRY_THREAD_LOCAL size_t mem_heap_area_size = 0;
 
 /**
  * The 'try to give memory back' callback
  */
-static mem_try_give_memory_back_callback_t mem_try_give_memory_back_callback = NULL;
+static JERRY_THREAD_LOCAL mem_try_give_memory_back_callback_t mem_try_give_memory_back_callback = NULL;
+
+#ifdef MEM_STATS
+static void mem_pools_stats_print (void);
+#endif /* MEM_STATS */
 
 /**
  * Initialize memory allocators.
  */
 void
-mem_init (void)
+mem_init (size_t heap_size) /**< heap size, multiple of MEM_HEAP_CHUNK_SIZE
+                             *   not exceeding MEM_HEAP_MAX_AREA_SIZE */
 {
-  mem_heap_init (mem_heap_area, sizeof (mem_heap_area));
-  mem_pools_init ();
+  JERRY_ASSERT (heap_size != 0 && heap_size <= MEM_HEAP_MAX_AREA_SIZE);
+
+  const size_t alignment = JERRY_MAX (MEM_ALIGNMENT, MEM_HEAP_CHUNK_SIZE);
+
+  mem_heap_area_block_p = malloc (heap_size + alignment - 1);
+
+  if (mem_heap_area_block_p == NULL)
+  {
+    jerry_fatal (ERR_OUT_OF_MEMORY);
+  }
+
+  mem_heap_area = (uint8_t *) JERRY_ALIGNUP ((uintptr_t) mem_heap_area_block_p, alignment);
+  mem_heap_area_size = heap_size;
+
+  mem_heap_init (mem_heap_area, mem_heap_area_size);
+  mem_pools_init (mem_heap_area_size);
 } /* mem_init */
 
 /**
@@ -62,26 +90,17 @@ mem_finalize (bool is_show_mem_stats) /**< show heap memory stats
     mem_heap_print (false, false, true);
 
 #ifdef MEM_STATS
-    mem_pools_stats_t stats;
-    mem_pools_get_stats (&stats);
-
-    printf ("Pools stats:\n");
-    printf (" Chunk size: %zu\n"
-            "  Pools: %zu\n"
-            "  Allocated chunks: %zu\n"
-            "  Free chunks: %zu\n"
-            "  Peak pools: %zu\n"
-            "  Peak allocated chunks: %zu\n\n",
-            MEM_POOL_CHUNK_SIZE,
-            stats.pools_count,
-            stats.allocated_chunks,
-            stats.free_chunks,
-            stats.peak_pools_count,
-            stats.peak_allocated_chunks);
+    mem_pools_stats_print ();
 #endif /* MEM_STATS */
   }
 
   mem_heap_finalize ();
+
+  free (mem_heap_area_block_p);
+
+  mem_heap_area_block_p = NULL;
+  mem_heap_area = NULL;
+  mem_heap_area_size = 0;
 } /* mem_finalize */
 
 /**
@@ -166,6 +185,11 @@ mem_run_try_to_give_memory_back_callbacks (mem_try_give_memory_back_severity_t s
   {
     mem_try_give_memory_back_callback (severity);
   }
+
+  /*
+   * Return empty pools kept by the pool manager, including ones emptied by the callbacks, to the heap
+   */
+  mem_pools_remove_empty_pools ();
 } /* mem_run_try_to_give_memory_back_callbacks */
 
 #ifndef JERRY_NDEBUG
@@ -183,7 +207,7 @@ mem_is_heap_pointer (void *pointer) /**< pointer */
 {
   uint8_t *uint8_pointer = (uint8_t*) pointer;
 
-  return (uint8_pointer >= mem_heap_area && uint8_pointer <= (mem_heap_area + MEM_HEAP_AREA_SIZE));
+  return (uint8_pointer >= mem_heap_area && uint8_pointer <= (mem_heap_area + mem_heap_area_size));
 } /* mem_is_heap_pointer */
 #endif /* !JERRY_NDEBUG */
 
@@ -199,28 +223,50 @@ mem_stats_reset_peak (void)
 } /* mem_stats_reset_peak */
 
 /**
- * Print memory usage statistics
+ * Print pools' memory usage statistics
  */
-void
-mem_stats_print (void)
+static void
+mem_pools_stats_print (void)
 {
-  mem_heap_print (false, false, true);
-
   mem_pools_stats_t stats;
   mem_pools_get_stats (&stats);
 
+  JERRY_STATIC_ASSERT (MEM_POOLS_STATS_OCCUPANCY_LEVELS_NUMBER == 4);
+
   printf ("Pools stats:\n");
   printf (" Chunk size: %zu\n"
           "  Pools: %zu\n"
           "  Allocated chunks: %zu\n"
           "  Free chunks: %zu\n"
           "  Peak pools: %zu\n"
-          "  Peak allocated chunks: %zu\n\n",
+          "  Peak allocated chunks: %zu\n"
+          "  Empty pools kept: %zu\n"
+          "  Full pools: %zu\n"
+          "  Pools by occupancy (<25%%, <50%%, <75%%, <=100%%): %zu, %zu, %zu, %zu\n"
+          "  Reused empty pools: %zu\n\n",
           MEM_POOL_CHUNK_SIZE,
           stats.pools_count,
           stats.allocated_chunks,
           stats.free_chunks,
           stats.peak_pools_count,
-          stats.peak_allocated_chunks);
+          stats.peak_allocated_chunks,
+          stats.empty_pools_count,
+          stats.full_pools_count,
+          stats.pools_by_occupancy[0],
+          stats.pools_by_occupancy[1],
+          stats.pools_by_occupancy[2],
+          stats.pools_by_occupancy[3],
+          stats.reused_empty_pools_count);
+} /* mem_pools_stats_print */
+
+/**
+ * Print memory usage statistics
+ */
+void
+mem_stats_print (void)
+{
+  mem_heap_print (false, false, true);
+
+  mem_pools_stats_print ();
 } /* mem_stats_print */
 #endif /* MEM_STATS */
@@ -28,11 +28,6 @@
 #include "mem-heap.h"
 #include "mem-poolman.h"
 
-/**
- * Compressed pointer
- */
-typedef uint16_t mem_cpointer_t;
-
 /**
  * Representation of NULL value for compressed pointers
  */
@@ -48,6 +43,15 @@ typedef uint16_t mem_cpointer_t;
  */
 #define MEM_CP_WIDTH (MEM_HEAP_OFFSET_LOG - MEM_ALIGNMENT_LOG)
 
+/**
+ * Compressed pointer
+ */
+#if MEM_CP_WIDTH <= 16
+typedef uint16_t mem_cpointer_t;
+#else /* MEM_CP_WIDTH > 16 */
+typedef uint32_t mem_cpointer_t;
+#endif /* MEM_CP_WIDTH > 16 */
+
 /**
  * Compressed pointer value mask
  */
@@ -119,7 +123,7 @@ typedef void (*mem_try_give_memory_back_callback_t) (mem_try_give_memory_back_se
     MEM_CP_SET_NON_NULL_POINTER (cp_value, non_compressed_pointer); \
   }
 
-extern void mem_init (void);
+extern void mem_init (size_t heap_size);
 extern void mem_finalize (bool is_show_mem_stats);
 
 extern uintptr_t mem_compress_pointer (const void *pointer);
@@ -24,10 +24,15 @@
 #define MEM_HEAP_OFFSET_LOG (CONFIG_MEM_HEAP_OFFSET_LOG)
 
 /**
- * Size of heap
+ * Default size of heap
  */
 #define MEM_HEAP_AREA_SIZE ((size_t) (CONFIG_MEM_HEAP_AREA_SIZE))
 
+/**
+ * Maximum size of heap
+ */
+#define MEM_HEAP_MAX_AREA_SIZE ((size_t) 1u << MEM_HEAP_OFFSET_LOG)
+
 /**
  * Size of heap chunk
  */
@@ -130,6 +130,42 @@ JERRY_STATIC_ASSERT (MEM_HEAP_CHUNK_SIZE >= sizeof (mem_block_header_t));
  */
 JERRY_STATIC_ASSERT (MEM_HEAP_CHUNK_SIZE % MEM_ALIGNMENT == 0);
 
+/**
+ * Log2 of number of second level size classes in a first level size class of free blocks
+ */
+#define MEM_HEAP_FREE_LISTS_SL_LOG (2u)
+
+/**
+ * Number of second level size classes in a first level size class of free blocks
+ */
+#define MEM_HEAP_FREE_LISTS_SL_COUNT (1u << MEM_HEAP_FREE_LISTS_SL_LOG)
+
+/**
+ * Number of first level size classes of free blocks
+ *
+ * Note:
+ *      first level class 0 holds blocks of less than MEM_HEAP_FREE_LISTS_SL_COUNT chunks, with a second level
+ *      class per size, and first level class i > 0 holds blocks of [2 ^ (i + SL_LOG - 1), 2 ^ (i + SL_LOG)) chunks,
+ *      split into MEM_HEAP_FREE_LISTS_SL_COUNT equal ranges.
+ */
+#define MEM_HEAP_FREE_LISTS_FL_COUNT (MEM_HEAP_OFFSET_LOG)
+
+/**
+ * Links of a free block in the list of its size class
+ *
+ * The lists are circular, and the links are located in the free block's data space.
+ */
+typedef struct
+{
+  mem_block_header_t *prev_free_p; /**< previous free block of the size class */
+  mem_block_header_t *next_free_p; /**< next free block of the size class */
+} mem_free_block_links_t;
+
+/**
+ * Any free block should have enough space for the links
+ */
+JERRY_STATIC_ASSERT (MEM_HEAP_CHUNK_SIZE >= sizeof (mem_block_header_t) + sizeof (mem_free_block_links_t));
+
 /**
  * Description of heap state
  */
@@ -142,12 +178,24 @@ typedef struct
   size_t allocated_bytes; /**< total size of allocated heap space */
   size_t limit; /**< current limit of heap usage, that is upon being reached,
                  *   causes call of "try give memory back" callbacks */
+  mem_block_header_t* free_lists[MEM_HEAP_FREE_LISTS_FL_COUNT][MEM_HEAP_FREE_LISTS_SL_COUNT]; /**< free blocks,
+                                                                                                *   by size class */
+  uint32_t free_lists_fl_bitmap; /**< first level size classes with free blocks */
+  uint8_t free_lists_sl_bitmap[MEM_HEAP_FREE_LISTS_FL_COUNT]; /**< second level size classes with free blocks */
 } mem_heap_state_t;
 
+JERRY_STATIC_ASSERT (MEM_HEAP_FREE_LISTS_FL_COUNT <= sizeof (uint32_t) * JERRY_BITSINBYTE);
+JERRY_STATIC_ASSERT (MEM_HEAP_FREE_LISTS_SL_COUNT <= sizeof (uint8_t) * JERRY_BITSINBYTE);
+
 /**
  * Heap state
  */
-mem_heap_state_t mem_heap;
+JERRY_THREAD_LOCAL mem_heap_state_t mem_heap;
+
+/**
+ * Desired limit of heap usage
+ */
+#define MEM_HEAP_DESIRED_LIMIT (mem_heap.heap_size >> CONFIG_MEM_HEAP_DESIRED_LIMIT_LOG)
 
 static size_t mem_get_block_chunks_count (const mem_block_header_t *block_header_p);
 static size_t mem_get_block_data_space_size (const mem_block_header_t *block_header_p);
@@ -160,13 +208,16 @@ static void mem_init_block_header (uint8_t *first_chunk_p,
                                    mem_block_length_type_t length_type,
                                    mem_block_header_t *prev_block_p,
                                    mem_block_header_t *next_block_p);
+static void mem_free_list_insert (mem_block_header_t *block_p);
+static void mem_free_list_remove (mem_block_header_t *block_p);
+static mem_block_header_t *mem_free_list_find (size_t size_in_chunks, mem_heap_alloc_term_t alloc_term);
 static void mem_check_heap (void);
 
 #ifdef MEM_STATS
 /**
  * Heap's memory usage statistics
  */
-static mem_heap_stats_t mem_heap_stats;
+static JERRY_THREAD_LOCAL mem_heap_stats_t mem_heap_stats;
 
 static void mem_heap_stat_init (void);
 static void mem_heap_stat_alloc_block (mem_block_header_t *block_header_p);
@@ -394,6 +445,311 @@ mem_is_block_free (const mem_block_header_t *block_header_p) /**< block header *
   return (block_header_p->allocated_bytes == 0);
 } /* mem_is_block_free */
 
+/**
+ * Get free block's links in the list of its size class
+ *
+ * @return pointer to the links
+ */
+static mem_free_block_links_t*
+mem_get_free_block_links (mem_block_header_t *block_header_p) /**< free block */
+{
+  return (mem_free_block_links_t*) (block_header_p + 1);
+} /* mem_get_free_block_links */
+
+/**
+ * Calculate log2 of the number, rounded down
+ *
+ * @return log2 of the number
+ */
+static uint32_t
+mem_heap_log2 (size_t value) /**< the number, non-zero */
+{
+  JERRY_ASSERT (value != 0);
+
+  return (uint32_t) (sizeof (unsigned long long) * JERRY_BITSINBYTE - 1u
+                     - (uint32_t) __builtin_clzll ((unsigned long long) value));
+} /* mem_heap_log2 */
+
+/**
+ * Get size class of free blocks with specified number of chunks
+ */
+static void
+mem_get_free_list_class (size_t size_in_chunks, /**< number of chunks in the block */
+                         uint32_t *out_fl_p, /**< out: first level class */
+                         uint32_t *out_sl_p) /**< out: second level class */
+{
+  JERRY_ASSERT (size_in_chunks != 0);
+
+  if (size_in_chunks < MEM_HEAP_FREE_LISTS_SL_COUNT)
+  {
+    *out_fl_p = 0;
+    *out_sl_p = (uint32_t) size_in_chunks;
+  }
+  else
+  {
+    const uint32_t log = mem_heap_log2 (size_in_chunks);
+
+    *out_fl_p = log - MEM_HEAP_FREE_LISTS_SL_LOG + 1u;
+    *out_sl_p = (uint32_t) (size_in_chunks >> (log - MEM_HEAP_FREE_LISTS_SL_LOG)) - MEM_HEAP_FREE_LISTS_SL_COUNT;
+  }
+
+  JERRY_ASSERT (*out_fl_p < MEM_HEAP_FREE_LISTS_FL_COUNT);
+  JERRY_ASSERT (*out_sl_p < MEM_HEAP_FREE_LISTS_SL_COUNT);
+} /* mem_get_free_list_class */
+
+/**
+ * Add free block to the list of its size class
+ *
+ * Note:
+ *      a block with lower address than the list's first block is prepended, a block with higher address
+ *      than the list's last block is appended, and other blocks are linked after the first one, so that
+ *      on insertion the first block is the lowest of the list and the last one is the highest. Long-term
+ *      allocations take blocks from the beginning of the lists and short-term ones from their end.
+ *
+ *      Removing a block from an end of a list makes its neighbour the new end, which is not necessarily
+ *      the lowest or highest remaining block, so the ordering is approximate: restoring it exactly would
+ *      take a walk over the list on every allocation. Long-term allocations still tend to the beginning
+ *      of the heap and short-term ones to its end.
+ *
+ * Note:
+ *      the block's header should be accessible.
+ */
+static void
+mem_free_list_insert (mem_block_header_t *block_p) /**< free block */
+{
+  JERRY_ASSERT (mem_is_block_free (block_p));
+
+  uint32_t fl, sl;
+  mem_get_free_list_class (mem_get_block_chunks_count (block_p), &fl, &sl);
+
+  mem_block_header_t *first_block_p = mem_heap.free_lists[fl][sl];
+  mem_free_block_links_t *links_p = mem_get_free_block_links (block_p);
+
+  VALGRIND_UNDEFINED_STRUCT (links_p);
+
+  if (first_block_p == NULL)
+  {
+    links_p->prev_free_p = block_p;
+    links_p->next_free_p = block_p;
+
+    mem_heap.free_lists[fl][sl] = block_p;
+    mem_heap.free_lists_fl_bitmap |= (1u << fl);
+    mem_heap.free_lists_sl_bitmap[fl] = (uint8_t) (mem_heap.free_lists_sl_bitmap[fl] | (1u << sl));
+  }
+  else
+  {
+    mem_free_block_links_t *first_links_p = mem_get_free_block_links (first_block_p);
+
+    VALGRIND_DEFINED_STRUCT (first_links_p);
+
+    mem_block_header_t *last_block_p = first_links_p->prev_free_p;
+
+    /* the block is linked between prev_block_p and next_block_p */
+    mem_block_header_t *prev_block_p;
+    mem_block_header_t *next_block_p;
+
+    if (block_p < first_block_p || block_p > last_block_p)
+    {
+      prev_block_p = last_block_p;
+      next_block_p = first_block_p;
+    }
+    else
+    {
+      prev_block_p = first_block_p;
+      next_block_p = first_links_p->next_free_p;
+    }
+
+    VALGRIND_NOACCESS_STRUCT (first_links_p);
+
+    mem_free_block_links_t *prev_links_p = mem_get_free_block_links (prev_block_p);
+    mem_free_block_links_t *next_links_p = mem_get_free_block_links (next_block_p);
+
+    links_p->prev_free_p = prev_block_p;
+    links_p->next_free_p = next_block_p;
+
+    VALGRIND_DEFINED_STRUCT (prev_links_p);
+    prev_links_p->next_free_p = block_p;
+    VALGRIND_NOACCESS_STRUCT (prev_links_p);
+
+    VALGRIND_DEFINED_STRUCT (next_links_p);
+    next_links_p->prev_free_p = block_p;
+    VALGRIND_NOACCESS_STRUCT (next_links_p);
+
+    if (block_p < first_block_p)
+    {
+      mem_heap.free_lists[fl][sl] = block_p;
+    }
+  }
+
+  VALGRIND_NOACCESS_STRUCT (links_p);
+} /* mem_free_list_insert */
+
+/**
+ * Remove free block from the list of its size class
+ *
+ * Note:
+ *      the block's header should be accessible.
+ */
+static void
+mem_free_list_remove (mem_block_header_t *block_p) /**< free block */
+{
+  JERRY_ASSERT (mem_is_block_free (block_p));
+
+  uint32_t fl, sl;
+  mem_get_free_list_class (mem_get_block_chunks_count (block_p), &fl, &sl);
+
+  mem_free_block_links_t *links_p = mem_get_free_block_links (block_p);
+
+  VALGRIND_DEFINED_STRUCT (links_p);
+
+  if (links_p->next_free_p == block_p)
+  {
+    JERRY_ASSERT (mem_heap.free_lists[fl][sl] == block_p);
+
+    mem_heap.free_lists[fl][sl] = NULL;
+    mem_heap.free_lists_sl_bitmap[fl] = (uint8_t) (mem_heap.free_lists_sl_bitmap[fl] & ~(1u << sl));
+
+    if (mem_heap.free_lists_sl_bitmap[fl] == 0)
+    {
+      mem_heap.free_lists_fl_bitmap &= ~(1u << fl);
+    }
+  }
+  else
+  {
+    mem_free_block_links_t *prev_links_p = mem_get_free_block_links (links_p->prev_free_p);
+    mem_free_block_links_t *next_links_p = mem_get_free_block_links (links_p->next_free_p);
+
+    VALGRIND_DEFINED_STRUCT (prev_links_p);
+    VALGRIND_DEFINED_STRUCT (next_links_p);
+
+    prev_links_p->next_free_p = links_p->next_free_p;
+    next_links_p->prev_free_p = links_p->prev_free_p;
+
+    VALGRIND_NOACCESS_STRUCT (next_links_p);
+    VALGRIND_NOACCESS_STRUCT (prev_links_p);
+
+    if (mem_heap.free_lists[fl][sl] == block_p)
+    {
+      mem_heap.free_lists[fl][sl] = links_p->next_free_p;
+    }
+  }
+
+  VALGRIND_NOACCESS_STRUCT (links_p);
+} /* mem_free_list_remove */
+
+/**
+ * Find free block of at least specified number of chunks
+ *
+ * The request is rounded up to the next size class boundary, so that the first non-empty class from there on
+ * holds only fitting blocks and is found with two bit scans. Only if there is no such class, the list of the
+ * request's own class is walked, which takes time linear in the list's length. A request larger than the
+ * whole heap is rejected without a search.
+ *
+ * @return pointer to the free block - if there is a fitting one,
+ *         NULL - otherwise.
+ */
+static mem_block_header_t*
+mem_free_list_find (size_t size_in_chunks, /**< required number of chunks */
+                    mem_heap_alloc_term_t alloc_term) /**< expected allocation term */
+{
+  if (size_in_chunks > mem_heap.heap_size / MEM_HEAP_CHUNK_SIZE)
+  {
+    return NULL;
+  }
+
+  const bool is_long_term = (alloc_term == MEM_HEAP_ALLOC_LONG_TERM);
+
+  size_t rounded_size_in_chunks = size_in_chunks;
+
+  if (size_in_chunks >= MEM_HEAP_FREE_LISTS_SL_COUNT)
+  {
+    rounded_size_in_chunks += ((size_t) 1u << (mem_heap_log2 (size_in_chunks) - MEM_HEAP_FREE_LISTS_SL_LOG)) - 1u;
+  }
+
+  if (rounded_size_in_chunks * MEM_HEAP_CHUNK_SIZE <= mem_heap.heap_size)
+  {
+    uint32_t fl, sl;
+    mem_get_free_list_class (rounded_size_in_chunks, &fl, &sl);
+
+    uint32_t sl_bitmap = mem_heap.free_lists_sl_bitmap[fl] & (~0u << sl);
+
+    if (sl_bitmap == 0)
+    {
+      const uint32_t fl_bitmap = (fl + 1u < MEM_HEAP_FREE_LISTS_FL_COUNT
+                                  ? mem_heap.free_lists_fl_bitmap & (~0u << (fl + 1u))
+                                  : 0);
+
+      if (fl_bitmap != 0)
+      {
+        fl = (uint32_t) __builtin_ctz (fl_bitmap);
+        sl_bitmap = mem_heap.free_lists_sl_bitmap[fl];
+      }
+    }
+
+    if (sl_bitmap != 0)
+    {
+      sl = (uint32_t) __builtin_ctz (sl_bitmap);
+
+      mem_block_header_t *block_p = mem_heap.free_lists[fl][sl];
+
+      if (!is_long_term)
+      {
+        mem_free_block_links_t *links_p = mem_get_free_block_links (block_p);
+
+        VALGRIND_DEFINED_STRUCT (links_p);
+        block_p = links_p->prev_free_p;
+        VALGRIND_NOACCESS_STRUCT (links_p);
+      }
+
+      return block_p;
+    }
+  }
+
+  /* blocks of the request's own class can still be large enough */
+  uint32_t fl, sl;
+  mem_get_free_list_class (size_in_chunks, &fl, &sl);
+
+  mem_block_header_t *first_block_p = mem_heap.free_lists[fl][sl];
+
+  if (first_block_p == NULL)
+  {
+    return NULL;
+  }
+
+  mem_block_header_t *block_p = first_block_p;
+
+  do
+  {
+    mem_free_block_links_t *links_p = mem_get_free_block_links (block_p);
+
+    VALGRIND_DEFINED_STRUCT (links_p);
+    mem_block_header_t *next_block_p = (is_long_term ? links_p->next_free_p : links_p->prev_free_p);
+    VALGRIND_NOACCESS_STRUCT (links_p);
+
+    if (!is_long_term)
+    {
+      block_p = next_block_p;
+    }
+
+    VALGRIND_DEFINED_STRUCT (block_p);
+    const size_t block_size_in_chunks = mem_get_block_chunks_count (block_p);
+    VALGRIND_NOACCESS_STRUCT (block_p);
+
+    if (block_size_in_chunks >= size_in_chunks)
+    {
+      return block_p;
+    }
+
+    if (is_long_term)
+    {
+      block_p = next_block_p;
+    }
+  }
+  while (block_p != first_block_p);
+
+  return NULL;
+} /* mem_free_list_find */
+
 /**
  * Startup initialization of heap
  *
@@ -416,7 +772,7 @@ mem_heap_init (uint8_t *heap_start, /**< first address of heap space */
 
   mem_heap.heap_start = heap_start;
   mem_heap.heap_size = heap_size;
-  mem_heap.limit = CONFIG_MEM_HEAP_DESIRED_LIMIT;
+  mem_heap.limit = MEM_HEAP_DESIRED_LIMIT;
 
   VALGRIND_NOACCESS_SPACE (heap_start, heap_size);
 
@@ -430,6 +786,10 @@ mem_heap_init (uint8_t *heap_start, /**< first address of heap space */
   mem_heap.first_block_p = (mem_block_header_t*) mem_heap.heap_start;
   mem_heap.last_block_p = mem_heap.first_block_p;
 
+  VALGRIND_DEFINED_STRUCT (mem_heap.first_block_p);
+  mem_free_list_insert (mem_heap.first_block_p);
+  VALGRIND_NOACCESS_STRUCT (mem_heap.first_block_p);
+
   MEM_HEAP_STAT_INIT ();
 } /* mem_heap_init */
 
@@ -512,40 +872,19 @@ void* mem_heap_alloc_block_internal (size_t size_in_bytes, /**< size of region t
 
   if (alloc_term == MEM_HEAP_ALLOC_LONG_TERM)
   {
-    block_p = mem_heap.first_block_p;
     direction = MEM_DIRECTION_NEXT;
   }
   else
   {
     JERRY_ASSERT (alloc_term == MEM_HEAP_ALLOC_SHORT_TERM);
 
-    block_p = mem_heap.last_block_p;
     direction = MEM_DIRECTION_PREV;
   }
 
-  /* searching for appropriate block */
-  while (block_p != NULL)
-  {
-    VALGRIND_DEFINED_STRUCT (block_p);
-
-    if (mem_is_block_free (block_p))
-    {
-      if (mem_get_block_data_space_size (block_p) >= size_in_bytes)
-      {
-        break;
-      }
-    }
-    else
-    {
-      JERRY_ASSERT (!mem_is_block_free (block_p));
-    }
-
-    mem_block_header_t *next_block_p = mem_get_next_block_by_direction (block_p, direction);
-
-    VALGRIND_NOACCESS_STRUCT (block_p);
+  size_t new_block_size_in_chunks = mem_get_block_chunks_count_from_data_size (size_in_bytes);
 
-    block_p = next_block_p;
-  }
+  /* searching for appropriate block */
+  block_p = mem_free_list_find (new_block_size_in_chunks, alloc_term);
 
   if (block_p == NULL)
   {
@@ -553,6 +892,13 @@ void* mem_heap_alloc_block_internal (size_t size_in_bytes, /**< size of region t
     return NULL;
   }
 
+  VALGRIND_DEFINED_STRUCT (block_p);
+
+  JERRY_ASSERT (mem_is_block_free (block_p));
+  JERRY_ASSERT (mem_get_block_data_space_size (block_p) >= size_in_bytes);
+
+  mem_free_list_remove (block_p);
+
   mem_heap.allocated_bytes += size_in_bytes;
 
   JERRY_ASSERT (mem_heap.allocated_bytes <= mem_heap.heap_size);
@@ -560,13 +906,12 @@ void* mem_heap_alloc_block_internal (size_t size_in_bytes, /**< size of region t
   if (mem_heap.allocated_bytes >= mem_heap.limit)
   {
     mem_heap.limit = JERRY_MIN (mem_heap.heap_size,
-                                JERRY_MAX (mem_heap.limit + CONFIG_MEM_HEAP_DESIRED_LIMIT,
+                                JERRY_MAX (mem_heap.limit + MEM_HEAP_DESIRED_LIMIT,
                                            mem_heap.allocated_bytes));
     JERRY_ASSERT (mem_heap.limit >= mem_heap.allocated_bytes);
   }
 
   /* appropriate block found, allocating space */
-  size_t new_block_size_in_chunks = mem_get_block_chunks_count_from_data_size (size_in_bytes);
   size_t found_block_size_in_chunks = mem_get_block_chunks_count (block_p);
 
   JERRY_ASSERT (new_block_size_in_chunks <= found_block_size_in_chunks);
@@ -587,6 +932,7 @@ void* mem_heap_alloc_block_internal (size_t size_in_bytes, /**< size of region t
       VALGRIND_DEFINED_STRUCT (prev_block_p);
 
       mem_set_block_next (prev_block_p, block_p);
+      mem_free_list_insert (prev_block_p);
 
       VALGRIND_NOACCESS_STRUCT (prev_block_p);
 
@@ -629,6 +975,10 @@ void* mem_heap_alloc_block_internal (size_t size_in_bytes, /**< size of region t
         VALGRIND_NOACCESS_STRUCT (next_block_p);
       }
 
+      VALGRIND_DEFINED_STRUCT (new_free_block_p);
+      mem_free_list_insert (new_free_block_p);
+      VALGRIND_NOACCESS_STRUCT (new_free_block_p);
+
       next_block_p = new_free_block_p;
     }
   }
@@ -792,9 +1142,9 @@ mem_heap_free_block (void *ptr) /**< pointer to beginning of data space of the b
   {
     mem_heap.limit /= 2;
   }
-  else if (mem_heap.allocated_bytes + CONFIG_MEM_HEAP_DESIRED_LIMIT <= mem_heap.limit)
+  else if (mem_heap.allocated_bytes + MEM_HEAP_DESIRED_LIMIT <= mem_heap.limit)
   {
-    mem_heap.limit -= CONFIG_MEM_HEAP_DESIRED_LIMIT;
+    mem_heap.limit -= MEM_HEAP_DESIRED_LIMIT;
   }
 
   JERRY_ASSERT (mem_heap.limit >= mem_heap.allocated_bytes);
@@ -818,6 +1168,8 @@ mem_heap_free_block (void *ptr) /**< pointer to beginning of data space of the b
       /* merge with the next block */
       MEM_HEAP_STAT_FREE_BLOCK_MERGE ();
 
+      mem_free_list_remove (next_block_p);
+
       mem_block_header_t *next_next_block_p = mem_get_next_block_by_direction (next_block_p, MEM_DIRECTION_NEXT);
 
       VALGRIND_NOACCESS_STRUCT (next_block_p);
@@ -840,6 +1192,8 @@ mem_heap_free_block (void *ptr) /**< pointer to beginning of data space of the b
     VALGRIND_NOACCESS_STRUCT (next_block_p);
   }
 
+  bool is_merged_with_prev_block = false;
+
   if (prev_block_p != NULL)
   {
     VALGRIND_DEFINED_STRUCT (prev_block_p);
@@ -849,6 +1203,8 @@ mem_heap_free_block (void *ptr) /**< pointer to beginning of data space of the b
       /* merge with the previous block */
       MEM_HEAP_STAT_FREE_BLOCK_MERGE ();
 
+      mem_free_list_remove (prev_block_p);
+
       mem_set_block_next (prev_block_p, next_block_p);
       if (next_block_p != NULL)
       {
@@ -863,11 +1219,20 @@ mem_heap_free_block (void *ptr) /**< pointer to beginning of data space of the b
       {
         mem_heap.last_block_p = prev_block_p;
       }
+
+      mem_free_list_insert (prev_block_p);
+
+      is_merged_with_prev_block = true;
     }
 
     VALGRIND_NOACCESS_STRUCT (prev_block_p);
   }
 
+  if (!is_merged_with_prev_block)
+  {
+    mem_free_list_insert (block_p);
+  }
+
   VALGRIND_NOACCESS_STRUCT (block_p);
 
   mem_check_heap ();
@@ -945,6 +1310,15 @@ mem_heap_get_chunked_block_start (void *ptr) /**< pointer into a block */
   return (void*) (block_p + 1);
 } /* mem_heap_get_chunked_block_start */
 
+/**
+ * Get size of the heap space
+ */
+size_t
+mem_heap_get_size (void)
+{
+  return mem_heap.heap_size;
+} /* mem_heap_get_size */
+
 /**
  * Get size of one-chunked block data space
  */
@@ -1068,6 +1442,7 @@ mem_check_heap (void)
   bool is_last_block_was_met = false;
   size_t chunk_sizes_sum = 0;
   size_t allocated_sum = 0;
+  size_t free_blocks_count = 0;
 
   for (mem_block_header_t *block_p = mem_heap.first_block_p, *next_block_p;
        block_p != NULL;
@@ -1084,6 +1459,10 @@ mem_check_heap (void)
     {
       allocated_sum += block_p->allocated_bytes;
     }
+    else
+    {
+      free_blocks_count++;
+    }
 
     next_block_p = mem_get_next_block_by_direction (block_p, MEM_DIRECTION_NEXT);
 
@@ -1134,6 +1513,61 @@ mem_check_heap (void)
 
   JERRY_ASSERT (chunk_sizes_sum * MEM_HEAP_CHUNK_SIZE == mem_heap.heap_size);
   JERRY_ASSERT (is_first_block_was_met);
+
+  size_t listed_free_blocks_count = 0;
+
+  for (uint32_t fl = 0; fl < MEM_HEAP_FREE_LISTS_FL_COUNT; fl++)
+  {
+    JERRY_ASSERT (((mem_heap.free_lists_fl_bitmap >> fl) & 1u) == (mem_heap.free_lists_sl_bitmap[fl] != 0));
+
+    for (uint32_t sl = 0; sl < MEM_HEAP_FREE_LISTS_SL_COUNT; sl++)
+    {
+      mem_block_header_t *first_block_p = mem_heap.free_lists[fl][sl];
+
+      JERRY_ASSERT (((mem_heap.free_lists_sl_bitmap[fl] >> sl) & 1u) == (first_block_p != NULL));
+
+      if (first_block_p == NULL)
+      {
+        continue;
+      }
+
+      mem_block_header_t *block_p = first_block_p;
+
+      do
+      {
+        VALGRIND_DEFINED_STRUCT (block_p);
+
+        uint32_t block_fl, block_sl;
+        mem_get_free_list_class (mem_get_block_chunks_count (block_p), &block_fl, &block_sl);
+
+        JERRY_ASSERT (mem_is_block_free (block_p));
+        JERRY_ASSERT (block_fl == fl && block_sl == sl);
+
+        mem_free_block_links_t *links_p = mem_get_free_block_links (block_p);
+
+        VALGRIND_DEFINED_STRUCT (links_p);
+
+        mem_block_header_t *next_block_p = links_p->next_free_p;
+
+        VALGRIND_NOACCESS_STRUCT (links_p);
+
+        mem_free_block_links_t *next_links_p = mem_get_free_block_links (next_block_p);
+
+        VALGRIND_DEFINED_STRUCT (next_links_p);
+        JERRY_ASSERT (next_links_p->prev_free_p == block_p);
+        VALGRIND_NOACCESS_STRUCT (next_links_p);
+
+        VALGRIND_NOACCESS_STRUCT (block_p);
+
+        listed_free_blocks_count++;
+
+        block_p = next_block_p;
+      }
+      while (block_p != first_block_p);
+    }
+  }
+
+  JERRY_ASSERT (listed_free_blocks_count == free_blocks_count);
 #endif /* !JERRY_DISABLE_HEAVY_DEBUG */
 } /* mem_check_heap */
 
@@ -54,6 +54,12 @@ static void mem_check_pool (mem_pool_state_t *pool_p);
 #define MEM_POOL_CHUNK_ADDRESS(pool_header_p, chunk_index) ((uint8_t*) (MEM_POOL_SPACE_START(pool_p) + \
                                                                         MEM_POOL_CHUNK_SIZE * chunk_index))
 
+/**
+ * Bitmap of a pool with all chunks free
+ */
+#define MEM_POOL_ALL_CHUNKS_FREE_BITMAP \
+  ((mem_pool_chunks_bitmap_t) (((mem_pool_chunks_bitmap_t) 1u << (MEM_POOL_CHUNKS_NUMBER - 1u) << 1u) - 1u))
+
 /**
  * Is the chunk is inside of the pool?
  *
@@ -88,8 +94,8 @@ mem_pool_init (mem_pool_state_t *pool_p, /**< pool */
   JERRY_ASSERT ((size_t)MEM_POOL_SPACE_START (pool_p) % MEM_ALIGNMENT == 0);
 
   JERRY_STATIC_ASSERT (MEM_POOL_CHUNK_SIZE % MEM_ALIGNMENT == 0);
-  JERRY_STATIC_ASSERT (MEM_POOL_MAX_CHUNKS_NUMBER_LOG <= sizeof (mem_pool_chunk_index_t) * JERRY_BITSINBYTE);
-  JERRY_ASSERT (sizeof (mem_pool_chunk_index_t) <= MEM_POOL_CHUNK_SIZE);
+  JERRY_STATIC_ASSERT (MEM_POOL_MAX_CHUNKS_NUMBER_LOG < sizeof (mem_pool_chunk_index_t) * JERRY_BITSINBYTE);
+  JERRY_STATIC_ASSERT ((1ull << MEM_POOL_MAX_CHUNKS_NUMBER_LOG) <= sizeof (mem_pool_chunks_bitmap_t) * JERRY_BITSINBYTE);
 
   JERRY_ASSERT (MEM_POOL_SIZE == sizeof (mem_pool_state_t) + MEM_POOL_CHUNKS_NUMBER * MEM_POOL_CHUNK_SIZE);
   JERRY_ASSERT (MEM_POOL_CHUNKS_NUMBER >= CONFIG_MEM_LEAST_CHUNK_NUMBER_IN_POOL);
@@ -102,28 +108,18 @@ mem_pool_init (mem_pool_state_t *pool_p, /**< pool */
   pool_p->free_chunks_number = (mem_pool_chunk_index_t) MEM_POOL_CHUNKS_NUMBER;
   JERRY_ASSERT (pool_p->free_chunks_number == MEM_POOL_CHUNKS_NUMBER);
 
-  /*
-   * Chunk with zero index is first free chunk in the pool now
-   */
-  pool_p->first_free_chunk = 0;
+  pool_p->free_chunks_bitmap = MEM_POOL_ALL_CHUNKS_FREE_BITMAP;
 
-  for (mem_pool_chunk_index_t chunk_index = 0;
-       chunk_index < MEM_POOL_CHUNKS_NUMBER;
-       chunk_index++)
-  {
-    mem_pool_chunk_index_t *next_free_chunk_index_p = (mem_pool_chunk_index_t*) MEM_POOL_CHUNK_ADDRESS (pool_p,
-                                                                                                        chunk_index);
-
-    *next_free_chunk_index_p = (mem_pool_chunk_index_t) (chunk_index + 1u);
-
-    VALGRIND_NOACCESS_SPACE (next_free_chunk_index_p, MEM_POOL_CHUNK_SIZE);
-  }
+  VALGRIND_NOACCESS_SPACE (MEM_POOL_SPACE_START (pool_p), MEM_POOL_CHUNKS_NUMBER * MEM_POOL_CHUNK_SIZE);
 
   mem_check_pool (pool_p);
 } /* mem_pool_init */
 
 /**
  * Allocate a chunk in the pool
+ *
+ * Note:
+ *      the free chunk with the lowest address is taken
  */
 uint8_t*
 mem_pool_alloc_chunk (mem_pool_state_t *pool_p) /**< pool */
@@ -131,15 +127,12 @@ mem_pool_alloc_chunk (mem_pool_state_t *pool_p) /**< pool */
   mem_check_pool (pool_p);
 
   JERRY_ASSERT (pool_p->free_chunks_number != 0);
-  JERRY_ASSERT (pool_p->first_free_chunk < MEM_POOL_CHUNKS_NUMBER);
+  JERRY_ASSERT (pool_p->free_chunks_bitmap != 0);
 
-  mem_pool_chunk_index_t chunk_index = pool_p->first_free_chunk;
+  mem_pool_chunk_index_t chunk_index = (mem_pool_chunk_index_t) __builtin_ctzll (pool_p->free_chunks_bitmap);
   uint8_t *chunk_p = MEM_POOL_CHUNK_ADDRESS (pool_p, chunk_index);
 
-  VALGRIND_DEFINED_SPACE (chunk_p, MEM_POOL_CHUNK_SIZE);
-
-  mem_pool_chunk_index_t *next_free_chunk_index_p = (mem_pool_chunk_index_t*) chunk_p;
-  pool_p->first_free_chunk = *next_free_chunk_index_p;
+  pool_p->free_chunks_bitmap &= pool_p->free_chunks_bitmap - 1u;
   pool_p->free_chunks_number--;
 
   VALGRIND_UNDEFINED_SPACE (chunk_p, MEM_POOL_CHUNK_SIZE);
@@ -164,15 +157,14 @@ mem_pool_free_chunk (mem_pool_state_t *pool_p,  /**< pool */
 
   const size_t chunk_byte_offset = (size_t) (chunk_p - MEM_POOL_SPACE_START (pool_p));
   const mem_pool_chunk_index_t chunk_index = (mem_pool_chunk_index_t) (chunk_byte_offset / MEM_POOL_CHUNK_SIZE);
+  const mem_pool_chunks_bitmap_t chunk_bit = (mem_pool_chunks_bitmap_t) 1u << chunk_index;
 
-  mem_pool_chunk_index_t *next_free_chunk_index_p = (mem_pool_chunk_index_t*) chunk_p;
+  JERRY_ASSERT ((pool_p->free_chunks_bitmap & chunk_bit) == 0);
 
-  *next_free_chunk_index_p = pool_p->first_free_chunk;
-
-  pool_p->first_free_chunk = chunk_index;
+  pool_p->free_chunks_bitmap |= chunk_bit;
   pool_p->free_chunks_number++;
 
-  VALGRIND_NOACCESS_SPACE (next_free_chunk_index_p, MEM_POOL_CHUNK_SIZE);
+  VALGRIND_NOACCESS_SPACE (chunk_p, MEM_POOL_CHUNK_SIZE);
 
   mem_check_pool (pool_p);
 } /* mem_pool_free_chunk */
@@ -185,25 +177,8 @@ mem_check_pool (mem_pool_state_t __attr_unused___ *pool_p) /**< pool (unused #if
 {
 #ifndef JERRY_DISABLE_HEAVY_DEBUG
   JERRY_ASSERT (pool_p->free_chunks_number <= MEM_POOL_CHUNKS_NUMBER);
-
-  size_t met_free_chunks_number = 0;
-  mem_pool_chunk_index_t chunk_index = pool_p->first_free_chunk;
-
-  while (chunk_index != MEM_POOL_CHUNKS_NUMBER)
-  {
-    uint8_t *chunk_p = MEM_POOL_CHUNK_ADDRESS (pool_p, chunk_index);
-    mem_pool_chunk_index_t *next_free_chunk_index_p = (mem_pool_chunk_index_t*) chunk_p;
-
-    met_free_chunks_number++;
-
-    VALGRIND_DEFINED_SPACE (next_free_chunk_index_p, MEM_POOL_CHUNK_SIZE);
-
-    chunk_index = *next_free_chunk_index_p;
-
-    VALGRIND_NOACCESS_SPACE (next_free_chunk_index_p, MEM_POOL_CHUNK_SIZE);
-  }
-
-  JERRY_ASSERT (met_free_chunks_number == pool_p->free_chunks_number);
+  JERRY_ASSERT ((pool_p->free_chunks_bitmap & ~MEM_POOL_ALL_CHUNKS_FREE_BITMAP) == 0);
+  JERRY_ASSERT ((size_t) __builtin_popcountll (pool_p->free_chunks_bitmap) == pool_p->free_chunks_number);
 #else /* !JERRY_DISABLE_HEAVY_DEBUG */
   (void) pool_p;
 #endif /* JERRY_DISABLE_HEAVY_DEBUG */
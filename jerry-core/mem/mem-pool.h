@@ -53,18 +53,26 @@
  */
 typedef uint8_t mem_pool_chunk_index_t;
 
+/**
+ * Bitmap of free chunks in a pool (bit is set - chunk is free)
+ */
+typedef uint64_t mem_pool_chunks_bitmap_t;
+
 /**
  * State of a memory pool
  */
 typedef struct __attribute__ ((aligned (MEM_ALIGNMENT))) mem_pool_state_t
 {
-  /** Offset of first free chunk from the beginning of the pool (mem_pool_chunk_index_t) */
-  mem_pool_chunk_index_t first_free_chunk : MEM_POOL_MAX_CHUNKS_NUMBER_LOG;
+  /** Free chunks of the pool (mem_pool_chunks_bitmap_t) */
+  mem_pool_chunks_bitmap_t free_chunks_bitmap;
 
   /** Number of free chunks (mem_pool_chunk_index_t) */
-  mem_pool_chunk_index_t free_chunks_number : MEM_POOL_MAX_CHUNKS_NUMBER_LOG;
+  mem_pool_chunk_index_t free_chunks_number;
+
+  /** Pointer to the previous pool with free chunks */
+  mem_cpointer_t prev_pool_cp : MEM_CP_WIDTH;
 
-  /** Pointer to the next pool with same chunk size */
+  /** Pointer to the next pool with free chunks */
   mem_cpointer_t next_pool_cp : MEM_CP_WIDTH;
 } mem_pool_state_t;
 
@@ -34,48 +34,110 @@
 #include "mem-poolman.h"
 
 /**
- * Lists of pools
+ * List of pools with free chunks
+ *
+ * Pools that regain a free chunk are put at the head of the list, so the chunk is reused first.
  */
-mem_pool_state_t *mem_pools;
+JERRY_THREAD_LOCAL mem_pool_state_t *mem_pools;
 
 /**
  * Number of free chunks
  */
-size_t mem_free_chunks_number;
+JERRY_THREAD_LOCAL size_t mem_free_chunks_number;
+
+/**
+ * Number of pools
+ */
+JERRY_THREAD_LOCAL size_t mem_pools_number;
+
+/**
+ * Number of empty pools kept instead of being returned to the heap
+ */
+JERRY_THREAD_LOCAL size_t mem_empty_pools_number;
+
+/**
+ * Pools' index: for each span of the heap, compressed pointer to the pool starting in the span
+ *
+ * A span is not larger than a pool, so no more than one pool starts in a span,
+ * and a chunk belongs to a pool starting in its span or in one of the two previous spans.
+ */
+JERRY_THREAD_LOCAL mem_cpointer_t *mem_pools_index;
+
+/**
+ * Number of entries in the pools' index
+ */
+JERRY_THREAD_LOCAL size_t mem_pools_index_length;
+
+/**
+ * Log2 of a span of the pools' index, in units of compressed pointers
+ */
+JERRY_THREAD_LOCAL uint32_t mem_pools_index_span_log;
+
+/**
+ * Number of the pools' index entries to check while looking for a chunk's pool
+ */
+#define MEM_POOLS_INDEX_LOOKUP_ENTRIES_NUMBER (3u)
 
 #ifdef MEM_STATS
 /**
  * Pools' memory usage statistics
  */
-mem_pools_stats_t mem_pools_stats;
+JERRY_THREAD_LOCAL mem_pools_stats_t mem_pools_stats;
 
 static void mem_pools_stat_init (void);
 static void mem_pools_stat_alloc_pool (void);
 static void mem_pools_stat_free_pool (void);
-static void mem_pools_stat_alloc_chunk (void);
-static void mem_pools_stat_free_chunk (void);
+static void mem_pools_stat_reuse_empty_pool (void);
+static void mem_pools_stat_alloc_chunk (mem_pool_state_t *pool_p);
+static void mem_pools_stat_free_chunk (mem_pool_state_t *pool_p);
 
 #  define MEM_POOLS_STAT_INIT() mem_pools_stat_init ()
 #  define MEM_POOLS_STAT_ALLOC_POOL() mem_pools_stat_alloc_pool ()
 #  define MEM_POOLS_STAT_FREE_POOL() mem_pools_stat_free_pool ()
-#  define MEM_POOLS_STAT_ALLOC_CHUNK() mem_pools_stat_alloc_chunk ()
-#  define MEM_POOLS_STAT_FREE_CHUNK() mem_pools_stat_free_chunk ()
+#  define MEM_POOLS_STAT_REUSE_EMPTY_POOL() mem_pools_stat_reuse_empty_pool ()
+#  define MEM_POOLS_STAT_ALLOC_CHUNK(pool_p) mem_pools_stat_alloc_chunk (pool_p)
+#  define MEM_POOLS_STAT_FREE_CHUNK(pool_p) mem_pools_stat_free_chunk (pool_p)
 #else /* !MEM_STATS */
 #  define MEM_POOLS_STAT_INIT()
 #  define MEM_POOLS_STAT_ALLOC_POOL()
 #  define MEM_POOLS_STAT_FREE_POOL()
-#  define MEM_POOLS_STAT_ALLOC_CHUNK()
-#  define MEM_POOLS_STAT_FREE_CHUNK()
+#  define MEM_POOLS_STAT_REUSE_EMPTY_POOL()
+#  define MEM_POOLS_STAT_ALLOC_CHUNK(pool_p)
+#  define MEM_POOLS_STAT_FREE_CHUNK(pool_p)
 #endif /* !MEM_STATS */
 
 /**
  * Initialize pool manager
  */
 void
-mem_pools_init (void)
+mem_pools_init (size_t heap_size) /**< heap size */
 {
   mem_pools = NULL;
   mem_free_chunks_number = 0;
+  mem_pools_number = 0;
+  mem_empty_pools_number = 0;
+
+  /*
+   * The span is the largest power of two that is not larger than a pool
+   */
+  uint32_t span_log = 0;
+  while ((2ull << span_log) <= MEM_POOL_SIZE)
+  {
+    span_log++;
+  }
+
+  JERRY_ASSERT (span_log >= MEM_ALIGNMENT_LOG);
+
+  mem_pools_index_span_log = span_log - MEM_ALIGNMENT_LOG;
+  mem_pools_index_length = (heap_size >> span_log) + 1u;
+
+  const size_t index_size = mem_pools_index_length * sizeof (mem_cpointer_t);
+
+  mem_pools_index = (mem_cpointer_t *) mem_heap_alloc_block (index_size, MEM_HEAP_ALLOC_LONG_TERM);
+  JERRY_ASSERT (mem_pools_index != NULL);
+
+  memset (mem_pools_index, 0, index_size);
+  JERRY_STATIC_ASSERT (MEM_CP_NULL == 0);
 
   MEM_POOLS_STAT_INIT ();
 } /* mem_pools_init */
@@ -86,61 +148,174 @@ mem_pools_init (void)
 void
 mem_pools_finalize (void)
 {
+  mem_pools_remove_empty_pools ();
+
   JERRY_ASSERT (mem_pools == NULL);
   JERRY_ASSERT (mem_free_chunks_number == 0);
+  JERRY_ASSERT (mem_pools_number == 0);
+
+  mem_heap_free_block ((uint8_t *) mem_pools_index);
+  mem_pools_index = NULL;
+  mem_pools_index_length = 0;
 } /* mem_pools_finalize */
 
 /**
- * Long path for mem_pools_alloc
+ * Get index of the pools' index entry corresponding to the span containing specified pointer
  *
- * @return true - if there is a free chunk in mem_pools,
- *         false - otherwise (not enough memory).
+ * @return entry index
  */
-static bool __attr_noinline___
-mem_pools_alloc_longpath (void)
+static size_t
+mem_pools_get_index_entry (const void *pointer) /**< pointer into the heap */
 {
-  /**
-   * If there are no free chunks, allocate new pool.
-   */
-  if (mem_free_chunks_number == 0)
+  size_t entry = mem_compress_pointer (pointer) >> mem_pools_index_span_log;
+
+  JERRY_ASSERT (entry < mem_pools_index_length);
+
+  return entry;
+} /* mem_pools_get_index_entry */
+
+/**
+ * Find the pool containing specified chunk
+ *
+ * @return pointer to the pool
+ */
+static mem_pool_state_t*
+mem_pools_get_chunk_pool (uint8_t *chunk_p) /**< chunk */
+{
+  size_t entry = mem_pools_get_index_entry (chunk_p);
+
+  for (uint32_t i = 0; i < MEM_POOLS_INDEX_LOOKUP_ENTRIES_NUMBER && i <= entry; i++)
   {
-    mem_pool_state_t *pool_state = (mem_pool_state_t*) mem_heap_alloc_block (MEM_POOL_SIZE, MEM_HEAP_ALLOC_LONG_TERM);
+    mem_cpointer_t pool_cp = mem_pools_index[entry - i];
 
-    JERRY_ASSERT (pool_state != NULL);
+    if (pool_cp != MEM_CP_NULL)
+    {
+      mem_pool_state_t *pool_p = MEM_CP_GET_NON_NULL_POINTER (mem_pool_state_t, pool_cp);
 
-    mem_pool_init (pool_state, MEM_POOL_SIZE);
+      if (mem_pool_is_chunk_inside (pool_p, chunk_p))
+      {
+        return pool_p;
+      }
+    }
+  }
 
-    MEM_CP_SET_POINTER (pool_state->next_pool_cp, mem_pools);
+  JERRY_UNREACHABLE ();
+} /* mem_pools_get_chunk_pool */
 
-    mem_pools = pool_state;
+/**
+ * Insert the pool at the head of the list of pools with free chunks
+ */
+static void
+mem_pools_list_insert (mem_pool_state_t *pool_p) /**< pool */
+{
+  pool_p->prev_pool_cp = MEM_CP_NULL;
+  MEM_CP_SET_POINTER (pool_p->next_pool_cp, mem_pools);
+
+  if (mem_pools != NULL)
+  {
+    MEM_CP_SET_NON_NULL_POINTER (mem_pools->prev_pool_cp, pool_p);
+  }
 
-    mem_free_chunks_number += MEM_POOL_CHUNKS_NUMBER;
+  mem_pools = pool_p;
+} /* mem_pools_list_insert */
 
-    MEM_POOLS_STAT_ALLOC_POOL ();
+/**
+ * Remove the pool from the list of pools with free chunks
+ */
+static void
+mem_pools_list_remove (mem_pool_state_t *pool_p) /**< pool */
+{
+  mem_pool_state_t *prev_pool_p = MEM_CP_GET_POINTER (mem_pool_state_t, pool_p->prev_pool_cp);
+  mem_pool_state_t *next_pool_p = MEM_CP_GET_POINTER (mem_pool_state_t, pool_p->next_pool_cp);
+
+  if (prev_pool_p != NULL)
+  {
+    prev_pool_p->next_pool_cp = pool_p->next_pool_cp;
   }
   else
   {
-    /**
-     * There is definitely at least one pool of specified type with at least one free chunk.
-     *
-     * Search for the pool.
-     */
-    mem_pool_state_t *pool_state = mem_pools, *prev_pool_state_p = NULL;
+    JERRY_ASSERT (mem_pools == pool_p);
+
+    mem_pools = next_pool_p;
+  }
+
+  if (next_pool_p != NULL)
+  {
+    next_pool_p->prev_pool_cp = pool_p->prev_pool_cp;
+  }
+} /* mem_pools_list_remove */
+
+/**
+ * Return an empty pool to the heap
+ */
+static void
+mem_pools_free_pool (mem_pool_state_t *pool_p) /**< pool */
+{
+  JERRY_ASSERT (pool_p->free_chunks_number == MEM_POOL_CHUNKS_NUMBER);
+
+  mem_pools_list_remove (pool_p);
+
+  size_t entry = mem_pools_get_index_entry (pool_p);
+  JERRY_ASSERT (mem_pools_index[entry] == mem_compress_pointer (pool_p));
+  mem_pools_index[entry] = MEM_CP_NULL;
+
+  mem_free_chunks_number -= MEM_POOL_CHUNKS_NUMBER;
+  mem_pools_number--;
+
+  mem_heap_free_block ((uint8_t*) pool_p);
+
+  MEM_POOLS_STAT_FREE_POOL ();
+} /* mem_pools_free_pool */
 
-    while (pool_state->first_free_chunk == MEM_POOL_CHUNKS_NUMBER)
+/**
+ * Return empty pools kept by the pool manager to the heap
+ */
+void
+mem_pools_remove_empty_pools (void)
+{
+  mem_pool_state_t *pool_p = mem_pools;
+
+  while (mem_empty_pools_number != 0)
+  {
+    JERRY_ASSERT (pool_p != NULL);
+
+    mem_pool_state_t *next_pool_p = MEM_CP_GET_POINTER (mem_pool_state_t, pool_p->next_pool_cp);
+
+    if (pool_p->free_chunks_number == MEM_POOL_CHUNKS_NUMBER)
     {
-      prev_pool_state_p = pool_state;
-      pool_state = MEM_CP_GET_NON_NULL_POINTER (mem_pool_state_t, pool_state->next_pool_cp);
-    }
+      mem_empty_pools_number--;
 
-    JERRY_ASSERT (prev_pool_state_p != NULL && pool_state != mem_pools);
+      mem_pools_free_pool (pool_p);
+    }
 
-    prev_pool_state_p->next_pool_cp = pool_state->next_pool_cp;
-    MEM_CP_SET_NON_NULL_POINTER (pool_state->next_pool_cp, mem_pools);
-    mem_pools = pool_state;
+    pool_p = next_pool_p;
   }
+} /* mem_pools_remove_empty_pools */
+
+/**
+ * Long path for mem_pools_alloc
+ *
+ * Allocate new pool and put it at the head of the list of pools with free chunks.
+ */
+static void __attr_noinline___
+mem_pools_alloc_longpath (void)
+{
+  mem_pool_state_t *pool_p = (mem_pool_state_t*) mem_heap_alloc_block (MEM_POOL_SIZE, MEM_HEAP_ALLOC_LONG_TERM);
+
+  JERRY_ASSERT (pool_p != NULL);
+
+  mem_pool_init (pool_p, MEM_POOL_SIZE);
 
-  return true;
+  size_t entry = mem_pools_get_index_entry (pool_p);
+  JERRY_ASSERT (mem_pools_index[entry] == MEM_CP_NULL);
+  MEM_CP_SET_NON_NULL_POINTER (mem_pools_index[entry], pool_p);
+
+  mem_pools_list_insert (pool_p);
+
+  mem_free_chunks_number += MEM_POOL_CHUNKS_NUMBER;
+  mem_pools_number++;
+
+  MEM_POOLS_STAT_ALLOC_POOL ();
 } /* mem_pools_alloc_longpath */
 
 /**
@@ -152,24 +327,42 @@ mem_pools_alloc_longpath (void)
 uint8_t*
 mem_pools_alloc (void)
 {
-  if (mem_pools == NULL || mem_pools->first_free_chunk == MEM_POOL_CHUNKS_NUMBER)
+  if (unlikely (mem_pools == NULL))
   {
-    if (!mem_pools_alloc_longpath ())
-    {
-      return NULL;
-    }
+    mem_pools_alloc_longpath ();
+  }
+  else if (mem_pools->free_chunks_number == MEM_POOL_CHUNKS_NUMBER)
+  {
+    /*
+     * The pool is one of the kept empty pools
+     */
+    JERRY_ASSERT (mem_empty_pools_number > 0);
+    mem_empty_pools_number--;
+
+    MEM_POOLS_STAT_REUSE_EMPTY_POOL ();
   }
 
-  JERRY_ASSERT (mem_pools != NULL && mem_pools->first_free_chunk != MEM_POOL_CHUNKS_NUMBER);
+  mem_pool_state_t *pool_p = mem_pools;
+
+  JERRY_ASSERT (pool_p != NULL && pool_p->free_chunks_number != 0);
 
   /**
    * And allocate chunk within it.
    */
+  uint8_t *chunk_p = mem_pool_alloc_chunk (pool_p);
   mem_free_chunks_number--;
 
-  MEM_POOLS_STAT_ALLOC_CHUNK ();
+  MEM_POOLS_STAT_ALLOC_CHUNK (pool_p);
 
-  return mem_pool_alloc_chunk (mem_pools);
+  /**
+   * Full pools are not kept in the list.
+   */
+  if (pool_p->free_chunks_number == 0)
+  {
+    mem_pools_list_remove (pool_p);
+  }
+
+  return chunk_p;
 } /* mem_pools_alloc */
 
 /**
@@ -178,52 +371,35 @@ mem_pools_alloc (void)
 void
 mem_pools_free (uint8_t *chunk_p) /**< pointer to the chunk */
 {
-  mem_pool_state_t *pool_state = mem_pools, *prev_pool_state_p = NULL;
+  mem_pool_state_t *pool_p = mem_pools_get_chunk_pool (chunk_p);
 
   /**
-   * Search for the pool containing specified chunk.
+   * Free the chunk
    */
-  while (!mem_pool_is_chunk_inside (pool_state, chunk_p))
+  if (pool_p->free_chunks_number == 0)
   {
-    prev_pool_state_p = pool_state;
-    pool_state = MEM_CP_GET_NON_NULL_POINTER (mem_pool_state_t, pool_state->next_pool_cp);
+    mem_pools_list_insert (pool_p);
   }
 
-  /**
-   * Free the chunk
-   */
-  mem_pool_free_chunk (pool_state, chunk_p);
+  mem_pool_free_chunk (pool_p, chunk_p);
   mem_free_chunks_number++;
 
-  MEM_POOLS_STAT_FREE_CHUNK ();
+  MEM_POOLS_STAT_FREE_CHUNK (pool_p);
 
   /**
-   * If all chunks of the pool are free, free the pool itself.
+   * If all chunks of the pool are free, keep the pool for reuse,
+   * unless enough empty pools are kept already.
    */
-  if (pool_state->free_chunks_number == MEM_POOL_CHUNKS_NUMBER)
+  if (pool_p->free_chunks_number == MEM_POOL_CHUNKS_NUMBER)
   {
-    if (prev_pool_state_p != NULL)
+    if (mem_empty_pools_number < CONFIG_MEM_POOLS_KEPT_EMPTY_POOLS_NUMBER)
     {
-      prev_pool_state_p->next_pool_cp = pool_state->next_pool_cp;
+      mem_empty_pools_number++;
     }
     else
     {
-      mem_pools = MEM_CP_GET_POINTER (mem_pool_state_t, pool_state->next_pool_cp);
+      mem_pools_free_pool (pool_p);
     }
-
-    mem_free_chunks_number -= MEM_POOL_CHUNKS_NUMBER;
-
-    mem_heap_free_block ((uint8_t*) pool_state);
-
-    MEM_POOLS_STAT_FREE_POOL ();
-  }
-  else if (mem_pools != pool_state)
-  {
-    JERRY_ASSERT (prev_pool_state_p != NULL);
-
-    prev_pool_state_p->next_pool_cp = pool_state->next_pool_cp;
-    MEM_CP_SET_NON_NULL_POINTER (pool_state->next_pool_cp, mem_pools);
-    mem_pools = pool_state;
   }
 } /* mem_pools_free */
 
@@ -236,6 +412,8 @@ mem_pools_get_stats (mem_pools_stats_t *out_pools_stats_p) /**< out: pools' stat
 {
   JERRY_ASSERT (out_pools_stats_p != NULL);
 
+  mem_pools_stats.empty_pools_count = mem_empty_pools_number;
+
   *out_pools_stats_p = mem_pools_stats;
 } /* mem_pools_get_stats */
 
@@ -258,6 +436,38 @@ mem_pools_stat_init (void)
   memset (&mem_pools_stats, 0, sizeof (mem_pools_stats));
 } /* mem_pools_stat_init */
 
+/**
+ * Get occupancy level of a pool with specified number of free chunks
+ *
+ * @return index in mem_pools_stats_t::pools_by_occupancy
+ */
+static size_t
+mem_pools_stat_get_occupancy_level (size_t free_chunks_number) /**< number of free chunks in the pool */
+{
+  JERRY_ASSERT (free_chunks_number <= MEM_POOL_CHUNKS_NUMBER);
+
+  size_t level = ((MEM_POOL_CHUNKS_NUMBER - free_chunks_number) * MEM_POOLS_STATS_OCCUPANCY_LEVELS_NUMBER
+                  / MEM_POOL_CHUNKS_NUMBER);
+
+  return JERRY_MIN (level, MEM_POOLS_STATS_OCCUPANCY_LEVELS_NUMBER - 1u);
+} /* mem_pools_stat_get_occupancy_level */
+
+/**
+ * Move a pool between occupancy levels
+ */
+static void
+mem_pools_stat_change_occupancy (size_t old_free_chunks_number, /**< previous number of free chunks in the pool */
+                                 size_t new_free_chunks_number) /**< current number of free chunks in the pool */
+{
+  size_t old_level = mem_pools_stat_get_occupancy_level (old_free_chunks_number);
+  size_t new_level = mem_pools_stat_get_occupancy_level (new_free_chunks_number);
+
+  JERRY_ASSERT (mem_pools_stats.pools_by_occupancy[old_level] > 0);
+
+  mem_pools_stats.pools_by_occupancy[old_level]--;
+  mem_pools_stats.pools_by_occupancy[new_level]++;
+} /* mem_pools_stat_change_occupancy */
+
 /**
  * Account allocation of a pool
  */
@@ -266,6 +476,7 @@ mem_pools_stat_alloc_pool (void)
 {
   mem_pools_stats.pools_count++;
   mem_pools_stats.free_chunks = mem_free_chunks_number;
+  mem_pools_stats.pools_by_occupancy[mem_pools_stat_get_occupancy_level (MEM_POOL_CHUNKS_NUMBER)]++;
 
   if (mem_pools_stats.pools_count > mem_pools_stats.peak_pools_count)
   {
@@ -285,21 +496,41 @@ mem_pools_stat_free_pool (void)
 {
   JERRY_ASSERT (mem_pools_stats.pools_count > 0);
 
+  size_t level = mem_pools_stat_get_occupancy_level (MEM_POOL_CHUNKS_NUMBER);
+  JERRY_ASSERT (mem_pools_stats.pools_by_occupancy[level] > 0);
+
   mem_pools_stats.pools_count--;
   mem_pools_stats.free_chunks = mem_free_chunks_number;
+  mem_pools_stats.pools_by_occupancy[level]--;
 } /* mem_pools_stat_free_pool */
 
+/**
+ * Account reuse of a kept empty pool
+ */
+static void
+mem_pools_stat_reuse_empty_pool (void)
+{
+  mem_pools_stats.reused_empty_pools_count++;
+} /* mem_pools_stat_reuse_empty_pool */
+
 /**
  * Account allocation of chunk in a pool
  */
 static void
-mem_pools_stat_alloc_chunk (void)
+mem_pools_stat_alloc_chunk (mem_pool_state_t *pool_p) /**< pool, the chunk was allocated in */
 {
   JERRY_ASSERT (mem_pools_stats.free_chunks > 0);
 
   mem_pools_stats.allocated_chunks++;
   mem_pools_stats.free_chunks--;
 
+  mem_pools_stat_change_occupancy (pool_p->free_chunks_number + 1u, pool_p->free_chunks_number);
+
+  if (pool_p->free_chunks_number == 0)
+  {
+    mem_pools_stats.full_pools_count++;
+  }
+
   if (mem_pools_stats.allocated_chunks > mem_pools_stats.peak_allocated_chunks)
   {
     mem_pools_stats.peak_allocated_chunks = mem_pools_stats.allocated_chunks;
@@ -314,12 +545,21 @@ mem_pools_stat_alloc_chunk (void)
  * Account freeing of chunk in a pool
  */
 static void
-mem_pools_stat_free_chunk (void)
+mem_pools_stat_free_chunk (mem_pool_state_t *pool_p) /**< pool, the chunk was freed in */
 {
   JERRY_ASSERT (mem_pools_stats.allocated_chunks > 0);
 
   mem_pools_stats.allocated_chunks--;
   mem_pools_stats.free_chunks++;
+
+  mem_pools_stat_change_occupancy (pool_p->free_chunks_number - 1u, pool_p->free_chunks_number);
+
+  if (pool_p->free_chunks_number == 1)
+  {
+    JERRY_ASSERT (mem_pools_stats.full_pools_count > 0);
+
+    mem_pools_stats.full_pools_count--;
+  }
 } /* mem_pools_stat_free_chunk */
 #endif /* MEM_STATS */
 
@@ -29,12 +29,18 @@
 
 #include "jrt.h"
 
-extern void mem_pools_init (void);
+extern void mem_pools_init (size_t heap_size);
 extern void mem_pools_finalize (void);
 extern uint8_t* mem_pools_alloc (void);
 extern void mem_pools_free (uint8_t *chunk_p);
+extern void mem_pools_remove_empty_pools (void);
 
 #ifdef MEM_STATS
+/**
+ * Number of occupancy levels in pools' memory usage statistics
+ */
+#define MEM_POOLS_STATS_OCCUPANCY_LEVELS_NUMBER (4)
+
 /**
  * Pools' memory usage statistics
  */
@@ -60,6 +66,20 @@ typedef struct
 
   /** free chunks count */
   size_t free_chunks;
+
+  /** count of empty pools kept instead of being returned to the heap */
+  size_t empty_pools_count;
+
+  /** full pools' count */
+  size_t full_pools_count;
+
+  /** pools' count by occupancy: i-th level counts pools with allocated chunks taking
+   *  [i / MEM_POOLS_STATS_OCCUPANCY_LEVELS_NUMBER; (i + 1) / MEM_POOLS_STATS_OCCUPANCY_LEVELS_NUMBER)
+   *  of the pool, the last one also counts full pools */
+  size_t pools_by_occupancy[MEM_POOLS_STATS_OCCUPANCY_LEVELS_NUMBER];
+
+  /** count of kept empty pools reused instead of allocating a new pool */
+  size_t reused_empty_pools_count;
 } mem_pools_stats_t;
 
 extern void mem_pools_get_stats (mem_pools_stats_t *out_pools_stats_p);
@@ -44,6 +44,8 @@ typedef struct __attribute__ ((aligned (MEM_ALIGNMENT)))
                                   *   See also: lit_id_hash_table_init */
   mem_cpointer_t next_instrs_cp; /**< pointer to next byte-code memory region */
   vm_instr_counter_t instructions_number; /**< number of instructions in the byte-code array */
+  uint32_t refs; /**< number of references to the byte-code: one for the parser or API owner
+                  *   and one for every function object that was created from it */
 } insts_data_header_t;
 
 typedef struct
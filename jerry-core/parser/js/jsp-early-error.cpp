@@ -28,12 +28,12 @@
  *          jsp_early_error_get_early_error_longjmp_label
  *          jsp_early_error_raise_error
  */
-static jmp_buf jsp_early_error_label;
+static JERRY_THREAD_LOCAL jmp_buf jsp_early_error_label;
 
 /**
  * Type of early error occured, or JSP_EARLY_ERROR__NO_ERROR
  */
-jsp_early_error_t jsp_early_error_type;
+JERRY_THREAD_LOCAL jsp_early_error_t jsp_early_error_type;
 
 typedef struct
 {
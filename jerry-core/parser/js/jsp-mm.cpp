@@ -37,7 +37,7 @@ typedef struct __attribute__ ((alignment (MEM_ALIGNMENT)))
 /**
  * List used for tracking memory blocks
  */
-jsp_mm_header_t *jsp_mm_blocks_p = NULL;
+JERRY_THREAD_LOCAL jsp_mm_header_t *jsp_mm_blocks_p = NULL;
 
 /**
  * Initialize managed memory allocator
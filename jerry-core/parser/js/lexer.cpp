@@ -23,10 +23,10 @@
 #include "lit-strings.h"
 #include "jsp-early-error.h"
 
-static token saved_token, prev_token, sent_token, empty_token;
+static JERRY_THREAD_LOCAL token saved_token, prev_token, sent_token, empty_token;
 
-static bool allow_dump_lines = false, strict_mode;
-static size_t buffer_size = 0;
+static JERRY_THREAD_LOCAL bool allow_dump_lines = false, strict_mode;
+static JERRY_THREAD_LOCAL size_t buffer_size = 0;
 
 /*
  * FIXME:
@@ -34,11 +34,11 @@ static size_t buffer_size = 0;
  */
 
 /* Represents the contents of a script.  */
-static const jerry_api_char_t *buffer_start = NULL;
-static lit_utf8_iterator_pos_t token_start_pos;
-static bool is_token_parse_in_progress = false;
+static JERRY_THREAD_LOCAL const jerry_api_char_t *buffer_start = NULL;
+static JERRY_THREAD_LOCAL lit_utf8_iterator_pos_t token_start_pos;
+static JERRY_THREAD_LOCAL bool is_token_parse_in_progress = false;
 
-static lit_utf8_iterator_t src_iter;
+static JERRY_THREAD_LOCAL lit_utf8_iterator_t src_iter;
 
 #define LA(I)       (get_char (I))
 #define TOK_START() (src_iter.buf_p + token_start_pos.offset)
@@ -137,7 +137,7 @@ create_token_from_lit (token_type type, literal_t lit)
  */
 static token
 create_token (token_type type,  /**< type of token */
-              uint16_t uid)     /**< uid of token */
+              mem_cpointer_t uid) /**< uid of token */
 {
   token ret;
 
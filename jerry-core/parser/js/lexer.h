@@ -163,7 +163,7 @@ typedef struct
 {
   locus loc;
   token_type type;
-  uint16_t uid;
+  mem_cpointer_t uid;
 } token;
 
 /**
@@ -19,7 +19,7 @@
 #include "stack.h"
 #include "jsp-early-error.h"
 
-static idx_t temp_name, max_temp_name;
+static JERRY_THREAD_LOCAL idx_t temp_name, max_temp_name;
 
 enum
 {
@@ -46,10 +46,10 @@ typedef enum
   JSP_EVAL_RET_STORE_DUMP, /**< dump */
 } jsp_eval_ret_store_t;
 
-static token tok;
-static bool inside_eval = false;
-static bool inside_function = false;
-static bool parser_show_instrs = false;
+static JERRY_THREAD_LOCAL token tok;
+static JERRY_THREAD_LOCAL bool inside_eval = false;
+static JERRY_THREAD_LOCAL bool inside_function = false;
+static JERRY_THREAD_LOCAL bool parser_show_instrs = false;
 
 enum
 {
@@ -19,9 +19,9 @@
 
 #define HASH_SIZE 128
 
-static hash_table lit_id_to_uid = null_hash;
-static vm_instr_counter_t global_oc;
-static idx_t next_uid;
+static JERRY_THREAD_LOCAL hash_table lit_id_to_uid = null_hash;
+static JERRY_THREAD_LOCAL vm_instr_counter_t global_oc;
+static JERRY_THREAD_LOCAL idx_t next_uid;
 
 static void
 assert_tree (scopes_tree t)
@@ -18,9 +18,9 @@
 #include "pretty-printer.h"
 #include "array-list.h"
 
-static bytecode_data_t bytecode_data;
-static scopes_tree current_scope;
-static bool print_instrs;
+static JERRY_THREAD_LOCAL bytecode_data_t bytecode_data;
+static JERRY_THREAD_LOCAL scopes_tree current_scope;
+static JERRY_THREAD_LOCAL bool print_instrs;
 
 static void
 serializer_print_instrs (const vm_instr_t *instrs_p,
@@ -116,6 +116,7 @@ serializer_merge_scopes_into_bytecode (void)
   insts_data_header_t *header_p = (insts_data_header_t*) buffer_p;
   MEM_CP_SET_POINTER (header_p->next_instrs_cp, bytecode_data.instrs_p);
   header_p->instructions_number = instrs_count;
+  header_p->refs = 1;
   bytecode_data.instrs_p = instrs_p;
 
   if (print_instrs)
@@ -173,6 +174,505 @@ serializer_rewrite_op_meta (const vm_instr_counter_t loc, op_meta op)
 #endif
 }
 
+/**
+ * Snapshot file format version
+ *
+ * Should be increased whenever the byte-code format or the snapshot layout changes
+ */
+#define SERIALIZER_SNAPSHOT_VERSION (1u)
+
+/**
+ * Snapshot file signature ("JRSN")
+ */
+#define SERIALIZER_SNAPSHOT_MAGIC (0x4e53524au)
+
+/**
+ * Literal index of a hash table bucket that doesn't refer to a literal
+ */
+#define SERIALIZER_SNAPSHOT_NO_LITERAL (UINT32_MAX)
+
+/**
+ * Header of a byte-code snapshot
+ *
+ * The header is followed by:
+ *  - the literal table: for every literal a uint32_t kind, a uint32_t payload size and the payload
+ *    (utf-8 characters of a string literal or the ecma_number_t value of a number literal);
+ *  - the instructions array;
+ *  - for every block of instructions, the uint32_t offset of its bucket in the raw buckets array
+ *    (SERIALIZER_SNAPSHOT_NO_LITERAL for blocks without literals);
+ *  - the raw buckets array, where every bucket is a uint32_t index in the literal table.
+ *
+ * No pointers are stored, so a snapshot could be loaded at any address.
+ */
+typedef struct
+{
+  uint32_t magic; /**< SERIALIZER_SNAPSHOT_MAGIC */
+  uint32_t version; /**< SERIALIZER_SNAPSHOT_VERSION */
+  uint16_t instr_size; /**< sizeof (vm_instr_t) of the engine that created the snapshot */
+  uint16_t number_size; /**< sizeof (ecma_number_t) of the engine that created the snapshot */
+  uint32_t instrs_count; /**< number of instructions */
+  uint32_t blocks_count; /**< number of instruction blocks */
+  uint32_t buckets_count; /**< number of buckets in the literal identifiers hash table */
+  uint32_t literals_count; /**< number of records in the literal table */
+  uint32_t literals_size; /**< size of the literal table, in bytes */
+} serializer_snapshot_header_t;
+
+/**
+ * Kinds of literal table records
+ */
+typedef enum
+{
+  SERIALIZER_SNAPSHOT_LITERAL_STRING, /**< string literal (including magic strings) */
+  SERIALIZER_SNAPSHOT_LITERAL_NUMBER /**< number literal */
+} serializer_snapshot_literal_kind_t;
+
+/**
+ * Write data to snapshot buffer, if it fits
+ *
+ * Note:
+ *      the offset is always advanced, so that the required buffer size could be calculated
+ *      by a pass with zero-sized buffer
+ */
+static void
+serializer_snapshot_write (uint8_t *buffer_p, /**< snapshot buffer */
+                           size_t buffer_size, /**< size of the buffer */
+                           size_t *offset_p, /**< in-out: write position */
+                           const void *data_p, /**< data to write */
+                           size_t data_size) /**< size of the data */
+{
+  if (*offset_p + data_size <= buffer_size)
+  {
+    memcpy (buffer_p + *offset_p, data_p, data_size);
+  }
+
+  *offset_p += data_size;
+} /* serializer_snapshot_write */
+
+/**
+ * Write literal table record for the literal to snapshot buffer
+ */
+static void
+serializer_snapshot_write_literal (uint8_t *buffer_p, /**< snapshot buffer */
+                                   size_t buffer_size, /**< size of the buffer */
+                                   size_t *offset_p, /**< in-out: write position */
+                                   lit_cpointer_t lit_cp) /**< literal */
+{
+  literal_t lit = lit_get_literal_by_cp (lit_cp);
+  const rcs_record_t::type_t type = lit->get_type ();
+
+  uint32_t kind;
+  uint32_t size;
+
+  if (type == LIT_NUMBER_T)
+  {
+    const ecma_number_t num = static_cast<lit_number_record_t *> (lit)->get_number ();
+
+    kind = SERIALIZER_SNAPSHOT_LITERAL_NUMBER;
+    size = (uint32_t) sizeof (ecma_number_t);
+
+    serializer_snapshot_write (buffer_p, buffer_size, offset_p, &kind, sizeof (kind));
+    serializer_snapshot_write (buffer_p, buffer_size, offset_p, &size, sizeof (size));
+    serializer_snapshot_write (buffer_p, buffer_size, offset_p, &num, sizeof (num));
+    return;
+  }
+
+  kind = SERIALIZER_SNAPSHOT_LITERAL_STRING;
+  serializer_snapshot_write (buffer_p, buffer_size, offset_p, &kind, sizeof (kind));
+
+  if (type == LIT_MAGIC_STR_T)
+  {
+    const lit_magic_string_id_t id = lit_magic_record_get_magic_str_id (lit);
+    size = lit_get_magic_string_size (id);
+
+    serializer_snapshot_write (buffer_p, buffer_size, offset_p, &size, sizeof (size));
+    serializer_snapshot_write (buffer_p, buffer_size, offset_p, lit_get_magic_string_utf8 (id), size);
+  }
+  else if (type == LIT_MAGIC_STR_EX_T)
+  {
+    const lit_magic_string_ex_id_t id = lit_magic_record_ex_get_magic_str_id (lit);
+    size = lit_get_magic_string_ex_size (id);
+
+    serializer_snapshot_write (buffer_p, buffer_size, offset_p, &size, sizeof (size));
+    serializer_snapshot_write (buffer_p, buffer_size, offset_p, lit_get_magic_string_ex_utf8 (id), size);
+  }
+  else
+  {
+    JERRY_ASSERT (type == LIT_STR_T);
+
+    size = lit_charset_record_get_size (lit);
+    serializer_snapshot_write (buffer_p, buffer_size, offset_p, &size, sizeof (size));
+
+    if (size != 0 && *offset_p + size <= buffer_size)
+    {
+      static_cast<lit_charset_record_t *> (lit)->get_charset (buffer_p + *offset_p, size);
+    }
+    *offset_p += size;
+  }
+} /* serializer_snapshot_write_literal */
+
+/**
+ * Save byte-code, its literal identifiers hash table and referenced literals to a snapshot
+ *
+ * Note:
+ *      nothing is written if the buffer is too small, so the call could be used
+ *      with zero-sized buffer to calculate required size of the buffer
+ *
+ * @return size of the snapshot
+ */
+size_t
+serializer_save_snapshot (const vm_instr_t *instrs_p, /**< byte-code to save */
+                          uint8_t *buffer_p, /**< buffer to save snapshot to */
+                          size_t buffer_size) /**< size of the buffer */
+{
+  JERRY_ASSERT (instrs_p != NULL);
+
+  const vm_instr_counter_t instrs_count = GET_BYTECODE_HEADER (instrs_p)->instructions_number;
+  const size_t blocks_count = (size_t) instrs_count / BLOCK_SIZE + 1;
+
+  lit_id_hash_table *lit_id_hash = GET_HASH_TABLE_FOR_BYTECODE (instrs_p);
+  const size_t buckets_count = (lit_id_hash == null_hash) ? 0 : lit_id_hash->current_bucket_pos;
+
+  /* Map every bucket to an index in the table of distinct literals */
+  uint32_t *bucket_literals_p = NULL;
+  lit_cpointer_t *literals_p = NULL;
+  uint32_t literals_count = 0;
+
+  if (buckets_count != 0)
+  {
+    bucket_literals_p = (uint32_t *) mem_heap_alloc_block (buckets_count * sizeof (uint32_t),
+                                                           MEM_HEAP_ALLOC_SHORT_TERM);
+    literals_p = (lit_cpointer_t *) mem_heap_alloc_block (buckets_count * sizeof (lit_cpointer_t),
+                                                          MEM_HEAP_ALLOC_SHORT_TERM);
+  }
+
+  for (size_t i = 0; i < buckets_count; i++)
+  {
+    const lit_cpointer_t lit_cp = lit_id_hash->raw_buckets[i];
+
+    if (lit_cp.packed_value == NOT_A_LITERAL.packed_value)
+    {
+      bucket_literals_p[i] = SERIALIZER_SNAPSHOT_NO_LITERAL;
+      continue;
+    }
+
+    uint32_t index;
+    for (index = 0; index < literals_count; index++)
+    {
+      if (literals_p[index].packed_value == lit_cp.packed_value)
+      {
+        break;
+      }
+    }
+
+    if (index == literals_count)
+    {
+      literals_p[literals_count++] = lit_cp;
+    }
+
+    bucket_literals_p[i] = index;
+  }
+
+  serializer_snapshot_header_t header;
+  header.magic = SERIALIZER_SNAPSHOT_MAGIC;
+  header.version = SERIALIZER_SNAPSHOT_VERSION;
+  header.instr_size = (uint16_t) sizeof (vm_instr_t);
+  header.number_size = (uint16_t) sizeof (ecma_number_t);
+  header.instrs_count = instrs_count;
+  header.blocks_count = (uint32_t) blocks_count;
+  header.buckets_count = (uint32_t) buckets_count;
+  header.literals_count = literals_count;
+
+  size_t offset = sizeof (header);
+
+  for (uint32_t index = 0; index < literals_count; index++)
+  {
+    serializer_snapshot_write_literal (buffer_p, buffer_size, &offset, literals_p[index]);
+  }
+
+  header.literals_size = (uint32_t) (offset - sizeof (header));
+
+  serializer_snapshot_write (buffer_p, buffer_size, &offset, instrs_p, instrs_count * sizeof (vm_instr_t));
+
+  for (size_t block_id = 0; block_id < blocks_count; block_id++)
+  {
+    uint32_t bucket_offset = SERIALIZER_SNAPSHOT_NO_LITERAL;
+
+    if (lit_id_hash != null_hash && lit_id_hash->buckets[block_id] != NULL)
+    {
+      bucket_offset = (uint32_t) (lit_id_hash->buckets[block_id] - lit_id_hash->raw_buckets);
+    }
+
+    serializer_snapshot_write (buffer_p, buffer_size, &offset, &bucket_offset, sizeof (bucket_offset));
+  }
+
+  serializer_snapshot_write (buffer_p, buffer_size, &offset, bucket_literals_p, buckets_count * sizeof (uint32_t));
+
+  if (buckets_count != 0)
+  {
+    mem_heap_free_block (literals_p);
+    mem_heap_free_block (bucket_literals_p);
+  }
+
+  if (offset <= buffer_size)
+  {
+    memcpy (buffer_p, &header, sizeof (header));
+  }
+
+  return offset;
+} /* serializer_save_snapshot */
+
+/**
+ * Load byte-code from a snapshot
+ *
+ * Literals of the snapshot are registered in the literal storage and the byte-code with its
+ * literal identifiers hash table is placed into a newly allocated byte-code memory region,
+ * which the caller owns and releases with serializer_release_bytecode.
+ *
+ * @return pointer to loaded byte-code - if the snapshot is valid,
+ *         NULL - otherwise.
+ */
+const vm_instr_t *
+serializer_load_snapshot (const uint8_t *snapshot_p, /**< snapshot */
+                          size_t snapshot_size) /**< size of the snapshot */
+{
+  serializer_snapshot_header_t header;
+
+  if (snapshot_size < sizeof (header))
+  {
+    return NULL;
+  }
+
+  memcpy (&header, snapshot_p, sizeof (header));
+
+  if (header.magic != SERIALIZER_SNAPSHOT_MAGIC
+      || header.version != SERIALIZER_SNAPSHOT_VERSION
+      || header.instr_size != sizeof (vm_instr_t)
+      || header.number_size != sizeof (ecma_number_t)
+      || header.instrs_count == 0
+      || header.instrs_count > MAX_OPCODES
+      || header.blocks_count != header.instrs_count / BLOCK_SIZE + 1)
+  {
+    return NULL;
+  }
+
+  /* Every literal table record takes at least its kind and size fields */
+  if (header.literals_size > snapshot_size - sizeof (header)
+      || header.literals_count > header.literals_size / (2 * sizeof (uint32_t)))
+  {
+    return NULL;
+  }
+
+  const size_t instrs_offset = sizeof (header) + (size_t) header.literals_size;
+  const size_t blocks_offset = instrs_offset + header.instrs_count * sizeof (vm_instr_t);
+  const size_t buckets_offset = blocks_offset + header.blocks_count * sizeof (uint32_t);
+
+  if (buckets_offset > snapshot_size
+      || header.buckets_count != (snapshot_size - buckets_offset) / sizeof (uint32_t)
+      || (snapshot_size - buckets_offset) % sizeof (uint32_t) != 0)
+  {
+    return NULL;
+  }
+
+  /* Register literals */
+  lit_cpointer_t *literals_p = NULL;
+
+  if (header.literals_count != 0)
+  {
+    literals_p = (lit_cpointer_t *) mem_heap_alloc_block (header.literals_count * sizeof (lit_cpointer_t),
+                                                          MEM_HEAP_ALLOC_SHORT_TERM);
+  }
+
+  size_t offset = sizeof (header);
+  bool is_valid = true;
+
+  for (uint32_t index = 0; index < header.literals_count && is_valid; index++)
+  {
+    uint32_t kind;
+    uint32_t size;
+
+    if (offset + sizeof (kind) + sizeof (size) > instrs_offset)
+    {
+      is_valid = false;
+      break;
+    }
+
+    memcpy (&kind, snapshot_p + offset, sizeof (kind));
+    memcpy (&size, snapshot_p + offset + sizeof (kind), sizeof (size));
+    offset += sizeof (kind) + sizeof (size);
+
+    if (offset + size > instrs_offset)
+    {
+      is_valid = false;
+      break;
+    }
+
+    literal_t lit;
+
+    if (kind == SERIALIZER_SNAPSHOT_LITERAL_NUMBER && size == sizeof (ecma_number_t))
+    {
+      ecma_number_t num;
+      memcpy (&num, snapshot_p + offset, sizeof (num));
+
+      lit = lit_find_or_create_literal_from_num (num);
+    }
+    else if (kind == SERIALIZER_SNAPSHOT_LITERAL_STRING)
+    {
+      lit = lit_find_or_create_literal_from_utf8_string (snapshot_p + offset, (lit_utf8_size_t) size);
+    }
+    else
+    {
+      is_valid = false;
+      break;
+    }
+
+    literals_p[index] = lit_cpointer_t::compress (lit);
+    offset += size;
+  }
+
+  if (offset != instrs_offset)
+  {
+    is_valid = false;
+  }
+
+  const vm_instr_t *instrs_p = NULL;
+
+  if (is_valid)
+  {
+    const size_t bytecode_array_size = JERRY_ALIGNUP (sizeof (insts_data_header_t)
+                                                      + header.instrs_count * sizeof (vm_instr_t),
+                                                      MEM_ALIGNMENT);
+    const size_t lit_id_hash_table_size = JERRY_ALIGNUP (lit_id_hash_table_get_size_for_table (header.buckets_count,
+                                                                                               header.blocks_count),
+                                                         MEM_ALIGNMENT);
+
+    uint8_t *buffer_p = (uint8_t *) mem_heap_alloc_block (bytecode_array_size + lit_id_hash_table_size,
+                                                          MEM_HEAP_ALLOC_LONG_TERM);
+
+    lit_id_hash_table *lit_id_hash = lit_id_hash_table_init (buffer_p + bytecode_array_size,
+                                                             lit_id_hash_table_size,
+                                                             header.buckets_count,
+                                                             header.blocks_count);
+
+    for (uint32_t i = 0; i < header.buckets_count && is_valid; i++)
+    {
+      uint32_t index;
+      memcpy (&index, snapshot_p + buckets_offset + i * sizeof (uint32_t), sizeof (index));
+
+      if (index == SERIALIZER_SNAPSHOT_NO_LITERAL)
+      {
+        lit_id_hash->raw_buckets[i] = NOT_A_LITERAL;
+      }
+      else if (index < header.literals_count)
+      {
+        lit_id_hash->raw_buckets[i] = literals_p[index];
+      }
+      else
+      {
+        is_valid = false;
+      }
+    }
+    lit_id_hash->current_bucket_pos = header.buckets_count;
+
+    for (uint32_t block_id = 0; block_id < header.blocks_count && is_valid; block_id++)
+    {
+      uint32_t bucket_offset;
+      memcpy (&bucket_offset, snapshot_p + blocks_offset + block_id * sizeof (uint32_t), sizeof (bucket_offset));
+
+      if (bucket_offset == SERIALIZER_SNAPSHOT_NO_LITERAL)
+      {
+        lit_id_hash->buckets[block_id] = NULL;
+      }
+      else if (bucket_offset < header.buckets_count)
+      {
+        lit_id_hash->buckets[block_id] = lit_id_hash->raw_buckets + bucket_offset;
+      }
+      else
+      {
+        is_valid = false;
+      }
+    }
+
+    if (is_valid)
+    {
+      insts_data_header_t *header_p = (insts_data_header_t *) buffer_p;
+      MEM_CP_SET_NON_NULL_POINTER (header_p->lit_id_hash_cp, lit_id_hash);
+      MEM_CP_SET_POINTER (header_p->next_instrs_cp, bytecode_data.instrs_p);
+      header_p->instructions_number = (vm_instr_counter_t) header.instrs_count;
+      header_p->refs = 1;
+
+      vm_instr_t *loaded_instrs_p = (vm_instr_t *) (buffer_p + sizeof (insts_data_header_t));
+      memcpy (loaded_instrs_p, snapshot_p + instrs_offset, header.instrs_count * sizeof (vm_instr_t));
+
+      bytecode_data.instrs_p = loaded_instrs_p;
+      instrs_p = loaded_instrs_p;
+    }
+    else
+    {
+      mem_heap_free_block (buffer_p);
+    }
+  }
+
+  if (literals_p != NULL)
+  {
+    mem_heap_free_block (literals_p);
+  }
+
+  return instrs_p;
+} /* serializer_load_snapshot */
+
+/**
+ * Add a reference to a byte-code memory region
+ */
+void
+serializer_acquire_bytecode (const vm_instr_t *instrs_p) /**< byte-code array */
+{
+  insts_data_header_t *header_p = GET_BYTECODE_HEADER (instrs_p);
+
+  JERRY_ASSERT (header_p->refs > 0 && header_p->refs < UINT32_MAX);
+  header_p->refs++;
+} /* serializer_acquire_bytecode */
+
+/**
+ * Remove a reference to a byte-code memory region
+ *
+ * The region is unlinked and freed when its last reference is removed. Byte-code that nobody
+ * releases (the global code, eval code) keeps its first reference and is freed in serializer_free.
+ */
+void
+serializer_release_bytecode (const vm_instr_t *instrs_p) /**< byte-code array */
+{
+  insts_data_header_t *header_p = GET_BYTECODE_HEADER (instrs_p);
+
+  JERRY_ASSERT (header_p->refs > 0);
+
+  if (--header_p->refs != 0)
+  {
+    return;
+  }
+
+  if (bytecode_data.instrs_p == instrs_p)
+  {
+    bytecode_data.instrs_p = MEM_CP_GET_POINTER (vm_instr_t, header_p->next_instrs_cp);
+  }
+  else
+  {
+    insts_data_header_t *prev_header_p = GET_BYTECODE_HEADER (bytecode_data.instrs_p);
+    const vm_instr_t *next_instrs_p = MEM_CP_GET_POINTER (vm_instr_t, prev_header_p->next_instrs_cp);
+
+    while (next_instrs_p != instrs_p)
+    {
+      JERRY_ASSERT (next_instrs_p != NULL);
+
+      prev_header_p = GET_BYTECODE_HEADER (next_instrs_p);
+      next_instrs_p = MEM_CP_GET_POINTER (vm_instr_t, prev_header_p->next_instrs_cp);
+    }
+
+    prev_header_p->next_instrs_cp = header_p->next_instrs_cp;
+  }
+
+  mem_heap_free_block (header_p);
+} /* serializer_release_bytecode */
+
 static void
 serializer_print_instrs (const vm_instr_t *instrs_p,
                          size_t instrs_count)
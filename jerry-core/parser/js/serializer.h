@@ -35,6 +35,10 @@ vm_instr_counter_t serializer_get_current_instr_counter (void);
 vm_instr_counter_t serializer_count_instrs_in_subscopes (void);
 void serializer_set_writing_position (vm_instr_counter_t);
 void serializer_rewrite_op_meta (vm_instr_counter_t, op_meta);
+size_t serializer_save_snapshot (const vm_instr_t *, uint8_t *, size_t);
+const vm_instr_t *serializer_load_snapshot (const uint8_t *, size_t);
+void serializer_acquire_bytecode (const vm_instr_t *);
+void serializer_release_bytecode (const vm_instr_t *);
 void serializer_free (void);
 
 #endif // SERIALIZER_H
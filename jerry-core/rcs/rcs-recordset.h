@@ -33,8 +33,15 @@
 
 /**
  * Logarithm of a dynamic storage unit alignment
+ *
+ * Note:
+ *      records' headers are one unit, so wider compressed pointers need wider units
  */
-#define RCS_DYN_STORAGE_ALIGNMENT_LOG (2u)
+#if MEM_CP_WIDTH <= 15
+# define RCS_DYN_STORAGE_ALIGNMENT_LOG (2u)
+#else /* MEM_CP_WIDTH > 15 */
+# define RCS_DYN_STORAGE_ALIGNMENT_LOG (3u)
+#endif /* MEM_CP_WIDTH > 15 */
 
 /**
  * Dynamic storage unit alignment
@@ -47,7 +54,7 @@
  * See also:
  *          rcs_dyn_storage_length_t
  */
-#define RCS_DYN_STORAGE_LENGTH_UNIT   (4u)
+#define RCS_DYN_STORAGE_LENGTH_UNIT   (1u << RCS_DYN_STORAGE_ALIGNMENT_LOG)
 
 /**
  * Dynamic storage
@@ -88,6 +95,15 @@ public:
   public:
     typedef uint8_t type_t;
 
+    /**
+     * Integer type of the header unit that contains the record's fields
+     */
+#if RCS_DYN_STORAGE_ALIGNMENT_LOG == 2
+    typedef uint32_t header_t;
+#else /* RCS_DYN_STORAGE_ALIGNMENT_LOG != 2 */
+    typedef uint64_t header_t;
+#endif /* RCS_DYN_STORAGE_ALIGNMENT_LOG != 2 */
+
     type_t get_type (void) const;
     void set_type (type_t type);
 
@@ -108,13 +124,13 @@ public:
         {
           mem_cpointer_t base_cp : MEM_CP_WIDTH; /**< pointer to base of addressed area */
 #if MEM_ALIGNMENT_LOG > RCS_DYN_STORAGE_ALIGNMENT_LOG
-          uint16_t ext     : (MEM_ALIGNMENT_LOG - RCS_DYN_STORAGE_ALIGNMENT_LOG); /**< extension of the basic
-                                                                                   *   compressed pointer
-                                                                                   *   used for more detailed
-                                                                                   *   addressing */
+          mem_cpointer_t ext : (MEM_ALIGNMENT_LOG - RCS_DYN_STORAGE_ALIGNMENT_LOG); /**< extension of the basic
+                                                                                     *   compressed pointer
+                                                                                     *   used for more detailed
+                                                                                     *   addressing */
 #endif /* MEM_ALIGNMENT_LOG > RCS_DYN_STORAGE_ALIGNMENT_LOG */
         } value;
-        uint16_t packed_value;
+        mem_cpointer_t packed_value;
       };
 
       static cpointer_t compress (record_t *pointer_p);
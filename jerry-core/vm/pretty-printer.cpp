@@ -52,7 +52,7 @@ static uint8_t opcode_sizes[] =
 #include "vm-opcodes.inc.h"
 };
 
-static char buff[ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER];
+static JERRY_THREAD_LOCAL char buff[ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER];
 
 static void
 clear_temp_buffer (void)
@@ -162,8 +162,8 @@ pp_printf (const char *format, vm_instr_t instr, lit_cpointer_t lit_ids[], vm_in
 #define OC(i, j) __extension__({ raw_instr* raw = (raw_instr *) &opm.op; \
                                  vm_calc_instr_counter_from_idx_idx (raw->uids[i], raw->uids[j]); })
 
-static int vargs_num = 0;
-static int seen_vargs = 0;
+static JERRY_THREAD_LOCAL int vargs_num = 0;
+static JERRY_THREAD_LOCAL int seen_vargs = 0;
 
 static void
 dump_asm (vm_instr_counter_t oc, vm_instr_t instr)
@@ -39,7 +39,7 @@
 /**
  * The top-most stack frame
  */
-vm_stack_frame_t* vm_stack_top_frame_p;
+JERRY_THREAD_LOCAL vm_stack_frame_t* vm_stack_top_frame_p;
 
 /**
  * Initialize stack
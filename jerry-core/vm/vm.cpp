@@ -28,7 +28,7 @@
 /**
  * Top (current) interpreter context
  */
-vm_frame_ctx_t *vm_top_context_p = NULL;
+JERRY_THREAD_LOCAL vm_frame_ctx_t *vm_top_context_p = NULL;
 
 static const opfunc __opfuncs[VM_OP__COUNT] =
 {
@@ -46,7 +46,7 @@ static const opfunc __opfuncs[VM_OP__COUNT] =
 
 JERRY_STATIC_ASSERT (sizeof (vm_instr_t) <= 4);
 
-const vm_instr_t *__program = NULL;
+JERRY_THREAD_LOCAL const vm_instr_t *__program = NULL;
 
 #ifdef MEM_STATS
 static const char *__op_names[VM_OP__COUNT] =
@@ -65,8 +65,8 @@ static const char *__op_names[VM_OP__COUNT] =
 
 #define INTERP_MEM_PRINT_INDENTATION_STEP (5)
 #define INTERP_MEM_PRINT_INDENTATION_MAX  (125)
-static uint32_t interp_mem_stats_print_indentation = 0;
-static bool interp_mem_stats_enabled = false;
+static JERRY_THREAD_LOCAL uint32_t interp_mem_stats_print_indentation = 0;
+static JERRY_THREAD_LOCAL bool interp_mem_stats_enabled = false;
 
 static void
 interp_mem_stats_print_legend (void)
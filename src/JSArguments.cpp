@@ -0,0 +1,37 @@
+/**
+ * Copyright (c) 2015 by Kota Iguchi. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+#include "Daisy/JSArguments.hpp"
+#include "Daisy/detail/JSUtil.hpp"
+
+namespace Daisy {
+
+	JSArguments::JSArguments(const JSContext& js_context, const jerry_api_value_t js_api_arguments[], const jerry_api_length_t argument_count) DAISY_NOEXCEPT
+		: js_context__(js_context)
+		, js_api_arguments__(js_api_arguments)
+		, argument_count__(argument_count) {
+	}
+
+	JSValue JSArguments::operator[](const std::size_t index) const DAISY_NOEXCEPT {
+		if (index < argument_count__) {
+			return JSValue(js_context__, detail::js_jerry_api_value_acquire(js_api_arguments__[index]));
+		}
+		return js_context__.CreateUndefined();
+	}
+
+	const jerry_api_value_t& JSArguments::get_api_value(const std::size_t index) const DAISY_NOEXCEPT {
+		static const jerry_api_value_t js_api_undefined = []() {
+			jerry_api_value_t js_api_value;
+			js_api_value.type = JERRY_API_DATA_TYPE_UNDEFINED;
+			return js_api_value;
+		}();
+		return index < argument_count__ ? js_api_arguments__[index] : js_api_undefined;
+	}
+
+	JSArguments::operator std::vector<JSValue>() const DAISY_NOEXCEPT {
+		return detail::to_vector(js_context__, js_api_arguments__, static_cast<jerry_api_length_t>(argument_count__));
+	}
+
+} // namespace Daisy {
@@ -6,41 +6,105 @@
 
 #include "Daisy/JSClass.hpp"
 #include "Daisy/JSObject.hpp"
+#include "Daisy/JSArguments.hpp"
 #include "Daisy/detail/JSUtil.hpp"
+#include "Daisy/detail/JSObjectData.hpp"
+#include "Daisy/detail/JSContextScope.hpp"
 #include <cassert>
 #include <iostream>
 
 namespace Daisy {
 	
-	JSClass::JSClass() DAISY_NOEXCEPT {
+	namespace {
+		struct JSClassPrototype {
+			// keeps the id alive so that its address is not reused by another class
+			std::shared_ptr<char> prototype_id;
+
+			// function properties followed by "prototype", ready for a bulk set
+			std::vector<jerry_api_string_t*> names;
+			std::vector<jerry_api_value_t>   values;
+		};
+
+		DAISY_THREAD_LOCAL std::unordered_map<const char*, JSClassPrototype> js_class_prototypes;
+
+#ifdef DAISY_THREAD_SAFE
+		std::recursive_mutex js_class_prototypes_mutex;
+#define DAISY_JSCLASS_PROTOTYPES_LOCK_GUARD std::lock_guard<std::recursive_mutex> lock_prototypes(js_class_prototypes_mutex)
+#else
+#define DAISY_JSCLASS_PROTOTYPES_LOCK_GUARD
+#endif  // DAISY_THREAD_SAFE
+
+		jerry_api_string_t* create_api_string(const std::string& value) {
+			return jerry_api_create_string_sz(reinterpret_cast<const jerry_api_char_t*>(value.data()), static_cast<jerry_api_size_t>(value.size()));
+		}
+	}
+
+	JSClass::JSClass() DAISY_NOEXCEPT
+		: prototype_id__(std::make_shared<char>()) {
 	}
 	
 	JSClass::~JSClass() DAISY_NOEXCEPT {
 	}
 	
 	JSClass::JSClass(const JSClass& rhs) DAISY_NOEXCEPT 
-		: prototype_functions_map__(rhs.prototype_functions_map__) {
+		: prototype_functions_map__(rhs.prototype_functions_map__)
+		, prototype_id__(rhs.prototype_id__) {
 	}
 	
 	JSClass::JSClass(JSClass&& rhs) DAISY_NOEXCEPT
-		: prototype_functions_map__(rhs.prototype_functions_map__) {
+		: prototype_functions_map__(std::move(rhs.prototype_functions_map__))
+		, prototype_id__(std::move(rhs.prototype_id__)) {
+	}
+
+	std::unordered_map<std::string, JSObjectCallAsFunctionCallback> JSClass::GetFunctionProperties() const {
+		return prototype_functions_map__;
 	}
 
 	void JSClass::ConstructorInitializeCallback(const JSContext& js_context, JSObject& this_object) const {
-		if (!this_object.HasProperty("prototype")) {
-			auto js_object = js_context.CreateObject();
-			this_object.SetProperty("prototype", js_object);
+		DAISY_JSCLASS_PROTOTYPES_LOCK_GUARD;
+		auto position = js_class_prototypes.find(prototype_id__.get());
+		if (position == js_class_prototypes.end()) {
+			JSClassPrototype js_class_prototype;
+			js_class_prototype.prototype_id = prototype_id__;
+
+			auto proto_object = js_context.CreateObject();
+			for (const auto& v : GetFunctionProperties()) {
+				auto function_object = JSObjectMakeFunctionWithCallback(js_context, v.first, v.second);
+				proto_object.SetProperty(v.first, function_object);
+				js_class_prototype.names.push_back(create_api_string(v.first));
+				js_class_prototype.values.push_back(detail::js_jerry_api_value_acquire(static_cast<jerry_api_value_t>(function_object)));
+			}
+			js_class_prototype.names.push_back(create_api_string("prototype"));
+			js_class_prototype.values.push_back(detail::js_jerry_api_value_acquire(static_cast<jerry_api_value_t>(proto_object)));
+
+			position = js_class_prototypes.emplace(prototype_id__.get(), std::move(js_class_prototype)).first;
 		}
 
-		auto proto_object = static_cast<JSObject>(this_object.GetProperty("prototype"));
-		for (const auto v : prototype_functions_map__) {
-			//
-			// NOTE: On HAL, there's no difference between object "static" property and prototype property
-			// so add it to both
-			//
-			this_object.SetProperty(v.first, JSObjectMakeFunctionWithCallback(js_context, v.first, v.second));
-			proto_object.SetProperty(v.first, JSObjectMakeFunctionWithCallback(js_context, v.first, v.second));
+		//
+		// NOTE: On HAL, there's no difference between object "static" property and prototype property
+		// so the shared function objects are set on both
+		//
+		const auto& js_class_prototype = position->second;
+		jerry_api_set_object_field_values(static_cast<jerry_api_value_t>(this_object).v_object,
+			js_class_prototype.names.data(), js_class_prototype.values.data(),
+			static_cast<jerry_api_length_t>(js_class_prototype.names.size()));
+	}
+
+	void JSClass::ClearPrototypeCache() DAISY_NOEXCEPT {
+		DAISY_JSCLASS_PROTOTYPES_LOCK_GUARD;
+		for (auto& v : js_class_prototypes) {
+			for (auto name : v.second.names) {
+				jerry_api_release_string(name);
+			}
+			for (auto& value : v.second.values) {
+				jerry_api_release_value(&value);
+			}
 		}
+		js_class_prototypes.clear();
+	}
+
+	void JSClass::ResetPrototype() DAISY_NOEXCEPT {
+		prototype_id__ = std::make_shared<char>();
 	}
 
 	static bool js_object_external_function_callback(
@@ -50,25 +114,20 @@ namespace Daisy {
 				const jerry_api_value_t js_api_arguments[],
 				const jerry_api_length_t argumentCount) {
 
-		const auto position = JSObject::js_object_external_functions_map__.find(function_object_ptr);
-		assert(position != JSObject::js_object_external_functions_map__.end());
-
-		auto callback = position->second;
+		const auto object_data = detail::JSObjectData::Get(function_object_ptr);
+		assert(object_data != nullptr && object_data->call_as_function_callback__);
 
-		// TODO: Use current context
-		JSContextGroup js_context_group;
-		const auto js_context = js_context_group.CreateContext();
-		auto function_object = JSObject(js_context, function_object_ptr);
-		auto this_object     = JSObject(js_context, *this_object_ptr);
-		const auto arguments = detail::to_vector(js_context, js_api_arguments, argumentCount);
+		const auto& callback = object_data->call_as_function_callback__;
 
-		auto callback_result = callback(function_object, this_object, arguments);
-		auto callback_result_value = static_cast<jerry_api_value_t>(callback_result);
+		const auto& js_context = detail::JSContextScope::current();
+		auto function_object = JSObject(js_context, jerry_api_acquire_object(const_cast<jerry_api_object_t*>(function_object_ptr)));
+		auto this_object     = JSObject(js_context, detail::js_jerry_api_value_acquire(*this_object_ptr));
+		const JSArguments arguments(js_context, js_api_arguments, argumentCount);
 
-		// callback value should be considered "unmanaged" from Daisy
-		callback_result.unmanaged();
+		const auto callback_result = callback(function_object, this_object, arguments);
 
-		detail::js_jerry_api_value_make_copy(callback_result_value, result_value_ptr);
+		// the engine releases the result value, so hand over a reference of its own
+		detail::js_jerry_api_value_make_copy(detail::js_jerry_api_value_acquire(static_cast<jerry_api_value_t>(callback_result)), result_value_ptr);
 
 		return true;
 	}
@@ -82,9 +141,9 @@ namespace Daisy {
 
 		auto function_object = JSObject(js_context, js_api_object);
 
-		const auto position = JSObject::js_object_external_functions_map__.find(js_api_object);
-		assert(position == JSObject::js_object_external_functions_map__.end());
-		JSObject::js_object_external_functions_map__.emplace(js_api_object, callback);
+		const auto object_data = detail::JSObjectData::Ensure(js_api_object);
+		assert(!object_data->call_as_function_callback__);
+		object_data->call_as_function_callback__ = callback;
 
 		return function_object;
 	}
@@ -93,6 +152,7 @@ namespace Daisy {
 		const auto position = prototype_functions_map__.find(name);
 		assert(position == prototype_functions_map__.end());
 		prototype_functions_map__.emplace(name, callback);
+		ResetPrototype();
 	}
 	
 	JSClass& JSClass::operator=(JSClass rhs) DAISY_NOEXCEPT {
@@ -104,6 +164,7 @@ namespace Daisy {
 	void JSClass::swap(JSClass& other) DAISY_NOEXCEPT {
 		DAISY_JSCLASS_LOCK_GUARD;
 		std::swap(prototype_functions_map__, other.prototype_functions_map__);
+		std::swap(prototype_id__, other.prototype_id__);
 	}
 	
 } // namespace Daisy {
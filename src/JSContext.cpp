@@ -10,10 +10,52 @@
 #include "Daisy/JSNumber.hpp"
 #include "Daisy/JSBoolean.hpp"
 #include "Daisy/JSString.hpp"
+#include "Daisy/JSPropertyKey.hpp"
 #include "Daisy/JSObject.hpp"
 #include "Daisy/JSClass.hpp"
+#include "Daisy/JSScript.hpp"
+#include "Daisy/detail/JSContextScope.hpp"
+#include "Daisy/detail/JSObjectData.hpp"
+#include <list>
+#include <unordered_map>
+
+#ifdef _WIN32
+#include <fstream>
+#include <vector>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 namespace Daisy {
+
+	namespace {
+		// Compiled scripts by source, the most recently used first. The
+		// cache holds a reference to every script in it, which is released
+		// when the script is evicted.
+		struct JSScriptCache {
+			typedef std::list<std::pair<std::string, const jerry_api_script_t*>> list_type;
+
+			bool enabled { false };
+			std::size_t capacity { 64 };
+			std::size_t hits { 0 };
+			std::size_t misses { 0 };
+			list_type scripts;
+			std::unordered_map<std::string, list_type::iterator> positions;
+
+			void EvictTo(const std::size_t size) DAISY_NOEXCEPT {
+				while (scripts.size() > size) {
+					jerry_api_release_script(scripts.back().second);
+					positions.erase(scripts.back().first);
+					scripts.pop_back();
+				}
+			}
+		};
+
+		DAISY_THREAD_LOCAL JSScriptCache js_script_cache;
+	}
 	
 	JSContext::~JSContext() DAISY_NOEXCEPT {
 
@@ -75,6 +117,11 @@ namespace Daisy {
 		return JSString(*this, value);
 	}
 
+	JSPropertyKey JSContext::CreatePropertyKey(const std::string& name) const DAISY_NOEXCEPT {
+		DAISY_JSCONTEXT_LOCK_GUARD;
+		return JSPropertyKey(JSString(*this, name));
+	}
+
 	JSObject JSContext::CreateObject() const DAISY_NOEXCEPT {
 		DAISY_JSCONTEXT_LOCK_GUARD;
 		return JSObject(*this);
@@ -90,6 +137,10 @@ namespace Daisy {
 
 	JSValue JSContext::JSEvaluateScript(const std::string& script) const {
 		DAISY_JSCONTEXT_LOCK_GUARD;
+		if (js_script_cache.enabled) {
+			return JSEvaluateScript(CreateScript(script));
+		}
+		const detail::JSContextScope js_context_scope(*this);
 		jerry_api_value_t ret_val;
 		const auto status = jerry_api_eval(
 			reinterpret_cast<const jerry_api_char_t *>(script.c_str()),
@@ -101,6 +152,152 @@ namespace Daisy {
 		}
 		return CreateUndefined();
 	}
+
+	JSValue JSContext::JSEvaluateScript(const JSScript& script) const {
+		DAISY_JSCONTEXT_LOCK_GUARD;
+		if (!script.IsCompiled()) {
+			// TODO: throw runtime exception
+			return CreateUndefined();
+		}
+		const detail::JSContextScope js_context_scope(*this);
+		jerry_api_value_t ret_val;
+		const auto status = jerry_api_run_script(script.js_api_script__, &ret_val);
+		if (status == JERRY_COMPLETION_CODE_OK) {
+			return JSValue(*this, ret_val);
+		} else {
+			// TODO: throw runtime exception
+		}
+		return CreateUndefined();
+	}
+
+	JSValue JSContext::EvaluateSnapshot(const std::uint8_t* snapshot, const std::size_t snapshot_size) const {
+		DAISY_JSCONTEXT_LOCK_GUARD;
+		const detail::JSContextScope js_context_scope(*this);
+		jerry_api_value_t ret_val;
+		const auto status = jerry_exec_snapshot(snapshot, snapshot_size, &ret_val);
+		if (status == JERRY_COMPLETION_CODE_OK) {
+			return JSValue(*this, ret_val);
+		} else {
+			// TODO: throw runtime exception
+		}
+		return CreateUndefined();
+	}
+
+	JSValue JSContext::EvaluateSnapshot(const std::string& snapshot_path) const {
+#ifdef _WIN32
+		std::ifstream file(snapshot_path, std::ios::binary);
+		const std::vector<std::uint8_t> snapshot((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+		if (snapshot.empty()) {
+			return CreateUndefined();
+		}
+		return EvaluateSnapshot(snapshot.data(), snapshot.size());
+#else
+		const auto fd = open(snapshot_path.c_str(), O_RDONLY);
+		if (fd < 0) {
+			return CreateUndefined();
+		}
+		struct stat file_stat;
+		if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0) {
+			close(fd);
+			return CreateUndefined();
+		}
+		const auto snapshot_size = static_cast<std::size_t>(file_stat.st_size);
+		const auto snapshot = mmap(nullptr, snapshot_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		close(fd);
+		if (snapshot == MAP_FAILED) {
+			return CreateUndefined();
+		}
+		const auto js_result = EvaluateSnapshot(static_cast<const std::uint8_t*>(snapshot), snapshot_size);
+		munmap(snapshot, snapshot_size);
+		return js_result;
+#endif
+	}
+
+	JSScript JSContext::CreateScript(const std::string& source) const {
+		DAISY_JSCONTEXT_LOCK_GUARD;
+		if (js_script_cache.enabled) {
+			const auto position = js_script_cache.positions.find(source);
+			if (position != js_script_cache.positions.end()) {
+				++js_script_cache.hits;
+				js_script_cache.scripts.splice(js_script_cache.scripts.begin(), js_script_cache.scripts, position->second);
+				return JSScript(*this, position->second->second);
+			}
+			++js_script_cache.misses;
+		}
+
+		const jerry_api_script_t* js_api_script = nullptr;
+		if (!jerry_api_compile(reinterpret_cast<const jerry_api_char_t *>(source.data()), source.size(), &js_api_script)) {
+			return JSScript(*this, nullptr);
+		}
+		JSScript js_script(*this, js_api_script);
+		if (js_script_cache.enabled && js_script_cache.capacity > 0) {
+			// The cache takes over the reference of the compilation.
+			js_script_cache.scripts.emplace_front(source, js_api_script);
+			js_script_cache.positions.emplace(source, js_script_cache.scripts.begin());
+			js_script_cache.EvictTo(js_script_cache.capacity);
+		} else {
+			jerry_api_release_script(js_api_script);
+		}
+		return js_script;
+	}
+
+	void JSContext::set_script_cache_enabled(const bool enabled) DAISY_NOEXCEPT {
+		DAISY_JSCONTEXT_LOCK_GUARD;
+		js_script_cache.enabled = enabled;
+	}
+
+	bool JSContext::get_script_cache_enabled() const DAISY_NOEXCEPT {
+		return js_script_cache.enabled;
+	}
+
+	void JSContext::set_script_cache_capacity(const std::size_t capacity) DAISY_NOEXCEPT {
+		DAISY_JSCONTEXT_LOCK_GUARD;
+		js_script_cache.capacity = capacity;
+		js_script_cache.EvictTo(capacity);
+	}
+
+	std::size_t JSContext::get_script_cache_capacity() const DAISY_NOEXCEPT {
+		return js_script_cache.capacity;
+	}
+
+	std::size_t JSContext::get_script_cache_size() const DAISY_NOEXCEPT {
+		return js_script_cache.scripts.size();
+	}
+
+	std::size_t JSContext::get_script_cache_hits() const DAISY_NOEXCEPT {
+		return js_script_cache.hits;
+	}
+
+	std::size_t JSContext::get_script_cache_misses() const DAISY_NOEXCEPT {
+		return js_script_cache.misses;
+	}
+
+	void JSContext::JSGarbageCollect() const DAISY_NOEXCEPT {
+		jerry_api_gc();
+	}
+
+	void JSContext::set_deferred_finalization_enabled(const bool enabled) DAISY_NOEXCEPT {
+		DAISY_JSCONTEXT_LOCK_GUARD;
+		detail::JSObjectData::SetFinalizationDeferred(enabled);
+	}
+
+	bool JSContext::get_deferred_finalization_enabled() const DAISY_NOEXCEPT {
+		return detail::JSObjectData::IsFinalizationDeferred();
+	}
+
+	std::size_t JSContext::get_pending_finalization_count() const DAISY_NOEXCEPT {
+		return detail::JSObjectData::GetPendingFinalizationCount();
+	}
+
+	std::size_t JSContext::DrainFinalizationQueue(const std::size_t max_count) const {
+		return detail::JSObjectData::DrainFinalizationQueue(max_count);
+	}
+
+	void JSContext::ClearScriptCache() DAISY_NOEXCEPT {
+		js_script_cache.EvictTo(0);
+		js_script_cache.hits   = 0;
+		js_script_cache.misses = 0;
+	}
 	
 	JSContext& JSContext::operator=(JSContext rhs) DAISY_NOEXCEPT {
 		DAISY_JSCONTEXT_LOCK_GUARD;
@@ -0,0 +1,34 @@
+/**
+ * Copyright (c) 2015 by Kota Iguchi. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "Daisy/JSContextExecutor.hpp"
+#include <memory>
+
+namespace Daisy {
+
+	JSContextExecutor::JSContextExecutor(const JSContext& js_context) DAISY_NOEXCEPT
+		: js_context__(js_context) {
+	}
+
+	JSContextExecutor::~JSContextExecutor() DAISY_NOEXCEPT {
+		// Jobs still queued are destroyed by the queue, which breaks
+		// their futures with std::future_errc::broken_promise.
+	}
+
+	std::size_t JSContextExecutor::RunPending(const std::size_t max_count) {
+		std::size_t count = 0;
+		while (count < max_count) {
+			const std::unique_ptr<detail::JSJob> js_job(js_job_queue__.Pop());
+			if (!js_job) {
+				break;
+			}
+			js_job->Run(js_context__);
+			++count;
+		}
+		return count;
+	}
+
+} // namespace Daisy {
@@ -7,32 +7,66 @@
 #include "Daisy/JSContextGroup.hpp"
 #include "Daisy/JSContext.hpp"
 #include "Daisy/JSObject.hpp"
+#include "Daisy/JSClass.hpp"
 #include "Daisy/JSValue.hpp"
+#include "Daisy/detail/JSObjectData.hpp"
 #include "jerry.h"
 #include <cassert>
+#include <utility>
 
 namespace Daisy {
 
-	std::size_t JSContextGroup::retainCount__ { 0 };
+	DAISY_THREAD_LOCAL std::size_t JSContextGroup::retainCount__ { 0 };
 
-	void JSContextGroup::EnsureJerryInit() {
+#ifdef DAISY_ENABLE_CONTEXTS
+	// The engine of this thread. It belongs to the first group created on
+	// the thread, and copies of that group share it.
+	static DAISY_THREAD_LOCAL jerry_ctx_t* js_api_ctx__ { nullptr };
+#endif
+
+	bool JSContextGroup::EnsureJerryInit(const std::size_t heap_size) {
 		DAISY_JSCONTEXTGROUP_LOCK_GUARD;
 		if (retainCount__ == 0) {
-			jerry_init(JERRY_FLAG_EMPTY);
+			jerry_init_with_heap_size(JERRY_FLAG_EMPTY, heap_size);
 			JSObject::js_api_global_object__ = jerry_api_get_global();
+#ifdef DAISY_ENABLE_CONTEXTS
+			js_api_ctx__ = jerry_new_ctx();
+			assert(js_api_ctx__ != nullptr);
+#endif
+		}
+#ifdef DAISY_ENABLE_CONTEXTS
+		else {
+			// The engine of this thread already belongs to another group,
+			// which this one would silently share.
+			assert(js_api_ctx__ != nullptr);
+			return false;
 		}
+#endif
 		++retainCount__;
+		return true;
 	}
-	
-	JSContextGroup::JSContextGroup() DAISY_NOEXCEPT {
-		EnsureJerryInit();
+
+	JSContextGroup::JSContextGroup() DAISY_NOEXCEPT
+		: valid__(EnsureJerryInit(0)) {
+	}
+
+	JSContextGroup::JSContextGroup(const std::size_t heap_size) DAISY_NOEXCEPT
+		: valid__(EnsureJerryInit(heap_size)) {
+	}
+
+	bool JSContextGroup::IsValid() const DAISY_NOEXCEPT {
+		return valid__;
 	}
 	
 	JSContext JSContextGroup::CreateContext() const DAISY_NOEXCEPT {
+		assert(valid__);
 		return JSContext();
 	}
 
 	JSContextGroup::~JSContextGroup() DAISY_NOEXCEPT {
+		if (!valid__) {
+			return;
+		}
 		assert(retainCount__ > 0);
 		assert(JSObject::js_api_global_object__ != nullptr);
 		--retainCount__;
@@ -40,28 +74,40 @@ namespace Daisy {
 			// make sure we have properly cleaned up resources
 
 			// Clean up global object
-			JSObject::js_object_external_functions_map__.erase(JSObject::js_api_global_object__);
-			JSObject::js_object_external_constructors_map__.erase(JSObject::js_api_global_object__);
-			JSObject::js_object_properties_map__.erase(JSObject::js_api_global_object__);
 			jerry_api_release_object(JSObject::js_api_global_object__);
 			JSObject::js_api_global_object__ = nullptr;
 
-			assert(JSObject::js_private_data_to_js_object_ref_map__.empty());
-			assert(JSObject::js_object_external_functions_map__.empty());
-			assert(JSObject::js_object_external_constructors_map__.empty());
-			assert(JSObject::js_object_properties_map__.empty());
-			assert(JSObject::js_object_finalizeCallback_map__.empty());
-			assert(JSValue::js_api_value_retain_count_map__.empty());
+			// Finalize what is still queued while the engine is alive, and
+			// let objects swept by the cleanup finalize right away.
+			detail::JSObjectData::DrainFinalizationQueue(SIZE_MAX);
+			detail::JSObjectData::SetFinalizationDeferred(false);
+
+			JSContext::ClearScriptCache();
+			JSClass::ClearPrototypeCache();
+#ifdef DAISY_ENABLE_CONTEXTS
+			jerry_cleanup_ctx(js_api_ctx__);
+			js_api_ctx__ = nullptr;
+#endif
 			jerry_cleanup();
 		}
 	}
 	
-	JSContextGroup::JSContextGroup(const JSContextGroup& rhs) DAISY_NOEXCEPT {
-		EnsureJerryInit();
+	// A copy shares the engine of a valid group, and a copy of an invalid
+	// group is invalid too.
+	JSContextGroup::JSContextGroup(const JSContextGroup& rhs) DAISY_NOEXCEPT
+		: valid__(rhs.valid__) {
+		if (valid__) {
+			DAISY_JSCONTEXTGROUP_LOCK_GUARD;
+			++retainCount__;
+		}
 	}
 	
-	JSContextGroup::JSContextGroup(JSContextGroup&& rhs) DAISY_NOEXCEPT {
-		EnsureJerryInit();
+	JSContextGroup::JSContextGroup(JSContextGroup&& rhs) DAISY_NOEXCEPT
+		: valid__(rhs.valid__) {
+		if (valid__) {
+			DAISY_JSCONTEXTGROUP_LOCK_GUARD;
+			++retainCount__;
+		}
 	}
 	
 	JSContextGroup& JSContextGroup::operator=(JSContextGroup rhs) DAISY_NOEXCEPT {
@@ -72,7 +118,7 @@ namespace Daisy {
 	
 	void JSContextGroup::swap(JSContextGroup& other) DAISY_NOEXCEPT {
 		// DAISY_JSCONTEXTGROUP_LOCK_GUARD;
-		// std::swap(js_context_group_ref__, other.js_context_group_ref__);
+		std::swap(valid__, other.valid__);
 	}
 	
 }
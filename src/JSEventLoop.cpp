@@ -0,0 +1,319 @@
+/**
+ * Copyright (c) 2015 by Kota Iguchi. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "Daisy/JSEventLoop.hpp"
+#include "Daisy/JSValue.hpp"
+#include "Daisy/JSNumber.hpp"
+#include "Daisy/JSArguments.hpp"
+#include "Daisy/JSClass.hpp"
+#include "Daisy/JSHandleScope.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <thread>
+
+namespace Daisy {
+
+	namespace {
+		const char* const js_event_loop_global_function_names[] = {
+			"setTimeout", "setInterval", "clearTimeout", "clearInterval", "queueMicrotask"
+		};
+
+		std::uint64_t to_delay(const JSValue& js_value) {
+			if (js_value.IsUndefined()) {
+				return 0;
+			}
+			const auto delay = static_cast<double>(js_value);
+			return (std::isnan(delay) || delay < 0) ? 0 : static_cast<std::uint64_t>(delay);
+		}
+	}
+
+	JSEventLoop::JSEventLoop(const JSContext& js_context) DAISY_NOEXCEPT
+		: js_context__(js_context)
+		, js_global_object__(js_context.get_global_object())
+		, start_time__(clock::now()) {
+	}
+
+	JSEventLoop::~JSEventLoop() DAISY_NOEXCEPT {
+		// The installed functions call back into this loop.
+		if (global_functions_installed__) {
+			for (const auto name : js_event_loop_global_function_names) {
+				js_global_object__.SetProperty(name, js_context__.CreateUndefined());
+			}
+		}
+	}
+
+	std::uint32_t JSEventLoop::SetTimeout(JSEventLoopTask task, const std::chrono::milliseconds& delay) {
+		return AddTimer(std::move(task), std::max<std::int64_t>(delay.count(), 0), 0);
+	}
+
+	std::uint32_t JSEventLoop::SetTimeout(JSObject function, const std::chrono::milliseconds& delay, std::vector<JSValue> arguments) {
+		return SetTimeout(MakeFunctionTask(function, std::move(arguments)), delay);
+	}
+
+	std::uint32_t JSEventLoop::SetInterval(JSEventLoopTask task, const std::chrono::milliseconds& interval) {
+		// An interval fires at most once per tick.
+		const std::uint64_t ticks = std::max<std::int64_t>(interval.count(), 1);
+		return AddTimer(std::move(task), ticks, ticks);
+	}
+
+	std::uint32_t JSEventLoop::SetInterval(JSObject function, const std::chrono::milliseconds& interval, std::vector<JSValue> arguments) {
+		return SetInterval(MakeFunctionTask(function, std::move(arguments)), interval);
+	}
+
+	void JSEventLoop::ClearTimer(const std::uint32_t timer_id) DAISY_NOEXCEPT {
+		const auto index = timer_id & timer_index_mask;
+		if (index >= timers__.size()) {
+			return;
+		}
+		auto& timer = timers__[index];
+		if (timer.id != timer_id || !timer.active) {
+			return;
+		}
+		// The id may still be in the wheel; it is skipped when its slot is reached.
+		timer.active = false;
+		timer.task   = nullptr;
+		--active_timer_count__;
+		free_timers__.push_back(index);
+	}
+
+	void JSEventLoop::QueueMicrotask(JSEventLoopTask task) {
+		microtasks__.push_back(std::move(task));
+	}
+
+	void JSEventLoop::QueueMicrotask(JSObject function) {
+		microtasks__.push_back(MakeFunctionTask(function, {}));
+	}
+
+	void JSEventLoop::InstallGlobalFunctions() {
+		JSClass js_class;
+
+		const auto set_timer = [this](const JSArguments& arguments, const bool repeat) -> JSValue {
+			const auto js_context = arguments.get_context();
+			const auto function = arguments[0];
+			if (!function.IsObject() || !static_cast<JSObject>(function).IsFunction()) {
+				return js_context.CreateUndefined();
+			}
+			std::vector<JSValue> timer_arguments;
+			for (std::size_t i = 2; i < arguments.size(); i++) {
+				timer_arguments.push_back(arguments[i]);
+			}
+			const std::chrono::milliseconds delay(to_delay(arguments[1]));
+			const auto timer_id = repeat
+				? SetInterval(static_cast<JSObject>(function), delay, std::move(timer_arguments))
+				: SetTimeout(static_cast<JSObject>(function), delay, std::move(timer_arguments));
+			return js_context.CreateNumber(timer_id);
+		};
+
+		const auto clear_timer = [this](JSObject, JSObject, const JSArguments& arguments) -> JSValue {
+			if (!arguments[0].IsUndefined()) {
+				ClearTimer(static_cast<std::uint32_t>(arguments[0]));
+			}
+			return arguments.get_context().CreateUndefined();
+		};
+
+		js_global_object__.SetProperty("setTimeout", js_class.JSObjectMakeFunctionWithCallback(js_context__, "setTimeout", [set_timer](JSObject, JSObject, const JSArguments& arguments) {
+			return set_timer(arguments, false);
+		}));
+		js_global_object__.SetProperty("setInterval", js_class.JSObjectMakeFunctionWithCallback(js_context__, "setInterval", [set_timer](JSObject, JSObject, const JSArguments& arguments) {
+			return set_timer(arguments, true);
+		}));
+		js_global_object__.SetProperty("clearTimeout", js_class.JSObjectMakeFunctionWithCallback(js_context__, "clearTimeout", clear_timer));
+		js_global_object__.SetProperty("clearInterval", js_class.JSObjectMakeFunctionWithCallback(js_context__, "clearInterval", clear_timer));
+		js_global_object__.SetProperty("queueMicrotask", js_class.JSObjectMakeFunctionWithCallback(js_context__, "queueMicrotask", [this](JSObject, JSObject, const JSArguments& arguments) -> JSValue {
+			const auto function = arguments[0];
+			if (function.IsObject() && static_cast<JSObject>(function).IsFunction()) {
+				QueueMicrotask(static_cast<JSObject>(function));
+			}
+			return arguments.get_context().CreateUndefined();
+		}));
+
+		global_functions_installed__ = true;
+	}
+
+	std::size_t JSEventLoop::RunPending() {
+		std::size_t count = DrainMicrotasks();
+		AdvanceTo(GetTick(clock::now()));
+
+		// Timers that become due while running wait for the next call, so a
+		// timeout that keeps rescheduling itself cannot starve the caller.
+		auto due_count = due_timers__.size();
+		while (due_count-- > 0) {
+			if (RunMacrotask()) {
+				++count;
+				count += DrainMicrotasks();
+			}
+		}
+		return count;
+	}
+
+	std::size_t JSEventLoop::RunUntil(const clock::time_point& deadline) {
+		std::size_t count = 0;
+		for (;;) {
+			count += RunPending();
+			if (!HasPendingTasks() || clock::now() >= deadline) {
+				break;
+			}
+			if (!due_timers__.empty() || !microtasks__.empty()) {
+				continue;
+			}
+			const auto next_time = start_time__ + std::chrono::milliseconds(GetNextTimerTick());
+			std::this_thread::sleep_until(std::min(next_time, deadline));
+		}
+		return count;
+	}
+
+	std::uint64_t JSEventLoop::GetTick(const clock::time_point& time_point) const DAISY_NOEXCEPT {
+		const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(time_point - start_time__).count();
+		return elapsed > 0 ? static_cast<std::uint64_t>(elapsed) : 0;
+	}
+
+	std::uint32_t JSEventLoop::AddTimer(JSEventLoopTask task, const std::uint64_t& delay, const std::uint64_t& interval) {
+		std::uint32_t index;
+		if (free_timers__.empty()) {
+			index = static_cast<std::uint32_t>(timers__.size());
+			assert(index <= timer_index_mask);
+			timers__.emplace_back();
+		} else {
+			index = free_timers__.back();
+			free_timers__.pop_back();
+		}
+
+		auto& timer = timers__[index];
+		auto generation = (timer.id >> timer_index_bits) + 1;
+		if (generation >> (32 - timer_index_bits)) {
+			generation = 1;
+		}
+		timer.id          = (generation << timer_index_bits) | index;
+		timer.task        = std::move(task);
+		timer.expiry_tick = std::max(GetTick(clock::now()) + delay, current_tick__);
+		timer.interval    = interval;
+		timer.active      = true;
+		++active_timer_count__;
+
+		InsertTimer(timer.id);
+		return timer.id;
+	}
+
+	void JSEventLoop::InsertTimer(const std::uint32_t timer_id) {
+		const auto& timer = timers__[timer_id & timer_index_mask];
+		if (timer.expiry_tick <= current_tick__) {
+			due_timers__.push_back(timer_id);
+			return;
+		}
+
+		// Level n covers timers due within 64^(n+1) ticks; the last level
+		// also takes anything further out and cascades it again later.
+		const auto delta = timer.expiry_tick - current_tick__;
+		std::uint32_t level = 0;
+		while (level + 1 < wheel_levels && delta >= (std::uint64_t(1) << (wheel_slot_bits * (level + 1)))) {
+			++level;
+		}
+		const auto slot = (timer.expiry_tick >> (wheel_slot_bits * level)) & (wheel_slot_count - 1);
+		wheel__[level][slot].push_back(timer_id);
+	}
+
+	void JSEventLoop::AdvanceTo(const std::uint64_t& tick) {
+		if (active_timer_count__ == 0) {
+			current_tick__ = std::max(current_tick__, tick);
+			return;
+		}
+
+		JSTimerSlot expired;
+		while (current_tick__ < tick) {
+			++current_tick__;
+
+			// The slot of the lowest level expires; each time a level wraps
+			// around, the current slot of the level above is cascaded down.
+			for (std::uint32_t level = 0; level < wheel_levels; level++) {
+				if (level > 0 && (current_tick__ & ((std::uint64_t(1) << (wheel_slot_bits * level)) - 1)) != 0) {
+					break;
+				}
+				const auto slot = (current_tick__ >> (wheel_slot_bits * level)) & (wheel_slot_count - 1);
+				expired.swap(wheel__[level][slot]);
+				for (const auto timer_id : expired) {
+					const auto& timer = timers__[timer_id & timer_index_mask];
+					if (timer.id == timer_id && timer.active) {
+						InsertTimer(timer_id);
+					}
+				}
+				expired.clear();
+				// Hand the capacity back to the slot unless it was refilled.
+				if (wheel__[level][slot].empty()) {
+					expired.swap(wheel__[level][slot]);
+				}
+			}
+		}
+	}
+
+	std::uint64_t JSEventLoop::GetNextTimerTick() const DAISY_NOEXCEPT {
+		if (!due_timers__.empty()) {
+			return current_tick__;
+		}
+		for (std::uint64_t tick = current_tick__ + 1; tick <= current_tick__ + wheel_slot_count; tick++) {
+			if (!wheel__[0][tick & (wheel_slot_count - 1)].empty()) {
+				return tick;
+			}
+		}
+		// Nothing in the lowest level; wake up for the next cascade.
+		return (current_tick__ | (wheel_slot_count - 1)) + 1;
+	}
+
+	bool JSEventLoop::RunMacrotask() {
+		const auto timer_id = due_timers__.front();
+		due_timers__.pop_front();
+
+		const auto index = timer_id & timer_index_mask;
+		auto& timer = timers__[index];
+		if (timer.id != timer_id || !timer.active) {
+			return false;
+		}
+
+		// The task is moved out so that it can clear its own timer.
+		auto task = std::move(timer.task);
+		if (timer.interval == 0) {
+			timer.active = false;
+			--active_timer_count__;
+			free_timers__.push_back(index);
+		} else {
+			timer.expiry_tick = std::max(GetTick(clock::now()), current_tick__) + timer.interval;
+			InsertTimer(timer_id);
+		}
+
+		task(js_context__);
+
+		auto& rearmed = timers__[index];
+		if (rearmed.id == timer_id && rearmed.active) {
+			rearmed.task = std::move(task);
+		}
+		return true;
+	}
+
+	std::size_t JSEventLoop::DrainMicrotasks() {
+		std::size_t count = 0;
+		// Microtasks queued by a microtask run in the same drain.
+		while (!microtasks__.empty()) {
+			const auto task = std::move(microtasks__.front());
+			microtasks__.pop_front();
+			task(js_context__);
+			++count;
+		}
+		return count;
+	}
+
+	JSEventLoopTask JSEventLoop::MakeFunctionTask(JSObject function, std::vector<JSValue> arguments) const {
+		// The task outlives any handle scope it is created in.
+		function = JSHandleScope::Persist(function);
+		for (auto& argument : arguments) {
+			argument = JSHandleScope::Persist(argument);
+		}
+		auto this_object = js_global_object__;
+		return [function, arguments, this_object](JSContext&) mutable {
+			function(arguments, this_object);
+		};
+	}
+
+} // namespace Daisy {
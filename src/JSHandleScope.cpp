@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2015 by Kota Iguchi. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "Daisy/JSHandleScope.hpp"
+#include "Daisy/detail/JSUtil.hpp"
+#include <cassert>
+#include <vector>
+
+namespace Daisy {
+
+	namespace {
+		// The references of every open scope on the thread, innermost
+		// last. Each scope owns the references from its begin__ onwards,
+		// so opening a scope allocates nothing.
+		DAISY_THREAD_LOCAL std::vector<jerry_api_value_t> js_handle_scope_values;
+		DAISY_THREAD_LOCAL JSHandleScope* js_handle_scope_current = nullptr;
+	}
+
+	JSHandleScope::JSHandleScope() DAISY_NOEXCEPT
+		: parent__(js_handle_scope_current)
+		, begin__(js_handle_scope_values.size()) {
+		js_handle_scope_current = this;
+	}
+
+	JSHandleScope::~JSHandleScope() DAISY_NOEXCEPT {
+		assert(js_handle_scope_current == this);
+		for (auto i = begin__; i < js_handle_scope_values.size(); i++) {
+			jerry_api_release_value(&js_handle_scope_values[i]);
+		}
+		js_handle_scope_values.resize(begin__);
+		js_handle_scope_current = parent__;
+	}
+
+	std::size_t JSHandleScope::size() const DAISY_NOEXCEPT {
+		assert(js_handle_scope_current == this);
+		return js_handle_scope_values.size() - begin__;
+	}
+
+	JSValue JSHandleScope::EscapeValue(const JSValue& js_value) {
+		assert(js_handle_scope_current == this);
+		if (parent__ == nullptr) {
+			return PersistValue(js_value);
+		}
+		if (js_value.js_api_value_retain_count__ || !(js_value.IsString() || js_value.IsObject())) {
+			return js_value;
+		}
+
+		// Move the first reference of this scope to the end and put the
+		// escaped one in its place, which is the end of the parent's part.
+		const auto js_api_value = detail::js_jerry_api_value_acquire(js_value.js_api_value__);
+		if (begin__ < js_handle_scope_values.size()) {
+			const auto first = js_handle_scope_values[begin__];
+			js_handle_scope_values.push_back(first);
+			js_handle_scope_values[begin__] = js_api_value;
+		} else {
+			js_handle_scope_values.push_back(js_api_value);
+		}
+		++begin__;
+		return JSValue(js_value.js_context__, js_api_value, false);
+	}
+
+	JSValue JSHandleScope::PersistValue(const JSValue& js_value) {
+		if (js_value.js_api_value_retain_count__ || !(js_value.IsString() || js_value.IsObject())) {
+			return js_value;
+		}
+		JSValue persistent(js_value.js_context__, detail::js_jerry_api_value_acquire(js_value.js_api_value__), false);
+		persistent.js_value_managed__ = true;
+		persistent.js_api_value_retain_count__ = new std::size_t(1);
+		return persistent;
+	}
+
+	bool JSHandleScope::Adopt(const jerry_api_value_t& js_api_value) DAISY_NOEXCEPT {
+		if (js_handle_scope_current == nullptr) {
+			return false;
+		}
+		js_handle_scope_values.push_back(js_api_value);
+		return true;
+	}
+
+} // namespace Daisy {
@@ -5,18 +5,16 @@
  */
 
 #include "Daisy/JSObject.hpp"
+#include "Daisy/JSString.hpp"
 #include "Daisy/detail/JSUtil.hpp"
+#include "Daisy/detail/JSObjectData.hpp"
+#include "Daisy/detail/JSContextScope.hpp"
 #include <cassert>
 #include <iostream>
 
 namespace Daisy {
 
-	std::unordered_map<const jerry_api_object_t*, JSObjectCallAsConstructorCallback> JSObject::js_object_external_constructors_map__;
-	std::unordered_map<const jerry_api_object_t*, JSObjectCallAsFunctionCallback> JSObject::js_object_external_functions_map__;
-	std::unordered_map<const jerry_api_object_t*, std::unordered_map<std::string, JSValue>> JSObject::js_object_properties_map__;
-	std::unordered_map<std::uintptr_t, JSObjectFinalizeCallback> JSObject::js_object_finalizeCallback_map__;
-	std::unordered_map<std::uintptr_t, const jerry_api_object_t*> JSObject::js_private_data_to_js_object_ref_map__;
-	jerry_api_object_t* JSObject::js_api_global_object__;
+	DAISY_THREAD_LOCAL jerry_api_object_t* JSObject::js_api_global_object__;
 
 	static bool js_api_object_constructor_function(
 				const jerry_api_object_t *function_object_ptr,
@@ -25,17 +23,15 @@ namespace Daisy {
 				const jerry_api_value_t js_api_arguments[],
 				const jerry_api_length_t argumentCount) {
 
-		const auto position = JSObject::js_object_external_constructors_map__.find(function_object_ptr);
-		assert(position != JSObject::js_object_external_constructors_map__.end());
+		const auto object_data = detail::JSObjectData::Get(function_object_ptr);
+		assert(object_data != nullptr);
 
-		auto callback = position->second;
+		const auto& callback = object_data->call_as_constructor_callback__;
 
-		// TODO: Use current context
-		JSContextGroup js_context_group;
-		const auto js_context = js_context_group.CreateContext();
+		const auto& js_context = detail::JSContextScope::current();
 		const auto arguments = detail::to_vector(js_context, js_api_arguments, argumentCount);
 
-		JSObject this_object = JSObject(js_context, this_object_ptr->v_object, false);
+		JSObject this_object = JSObject(js_context, jerry_api_acquire_object(this_object_ptr->v_object));
 
 		callback(js_context, this_object, arguments);
 
@@ -50,9 +46,8 @@ namespace Daisy {
 	jerry_api_value_t JSObject::MakeConstructorObject(const JSClass& js_class) DAISY_NOEXCEPT {
 		auto js_api_object = MakeObject(jerry_api_create_external_function(js_api_object_constructor_function));
 
-		const auto position = JSObject::js_object_external_constructors_map__.find(js_api_object.v_object);
-		assert(position == JSObject::js_object_external_constructors_map__.end());
-		JSObject::js_object_external_constructors_map__.emplace(js_api_object.v_object, js_class.getCallAsConstructorCallback());
+		const auto object_data = detail::JSObjectData::Ensure(js_api_object.v_object);
+		object_data->call_as_constructor_callback__ = js_class.getCallAsConstructorCallback();
 
 		return js_api_object;
 	}
@@ -64,45 +59,23 @@ namespace Daisy {
 		return js_api_value;
 	}
 
-	void JSObject::FinalizePrivateData(std::uintptr_t native_ptr) {
-		const auto position = JSObject::js_object_finalizeCallback_map__.find(native_ptr);
-		const bool found    = position != JSObject::js_object_finalizeCallback_map__.end();
-
-		if (!found) {
-			return;
-		}
-
-		position->second(native_ptr);
-		JSObject::js_object_finalizeCallback_map__.erase(native_ptr);
-		JSObject::js_private_data_to_js_object_ref_map__.erase(native_ptr);
-	}
-
 	std::uintptr_t JSObject::GetPrivate() const {
-		std::uintptr_t handle;
-		jerry_api_get_object_native_handle(js_api_value__.v_object, &handle);
-		return handle;
+		const auto object_data = detail::JSObjectData::Get(js_api_value__.v_object);
+		return object_data ? object_data->private_data__ : 0;
 	}
 
 	void JSObject::SetPrivate(const std::uintptr_t& native_ptr, const JSObjectFinalizeCallback finalize_callback) {
-		const auto position = js_object_finalizeCallback_map__.find(native_ptr);
-		const bool found    = position != js_object_finalizeCallback_map__.end();
-
-		assert(!found);
-		js_object_finalizeCallback_map__.emplace(native_ptr, finalize_callback);
-
-		jerry_api_set_object_native_handle(js_api_value__.v_object, native_ptr, NULL);
-
-		assert(js_private_data_to_js_object_ref_map__.find(native_ptr) == js_private_data_to_js_object_ref_map__.end());
-		js_private_data_to_js_object_ref_map__.emplace(native_ptr, js_api_value__.v_object);
+		const auto object_data = detail::JSObjectData::Ensure(js_api_value__.v_object);
+		object_data->private_data__ = native_ptr;
+		object_data->private_data_finalize_callback__ = finalize_callback;
+		object_data->private_data_finalize_function__ = nullptr;
 	}
 
-	JSObject JSObject::FindJSObjectFromPrivateData(const JSContext& js_context, const std::uintptr_t& native_ptr) {
-		const auto position = js_private_data_to_js_object_ref_map__.find(native_ptr);
-		const bool found    = position != js_private_data_to_js_object_ref_map__.end();
-
-		assert(found);
-
-		return JSObject(js_context, position->second);
+	void JSObject::SetPrivateWithFinalizer(const std::uintptr_t& native_ptr, const JSObjectFinalizeFunction finalize_function) {
+		const auto object_data = detail::JSObjectData::Ensure(js_api_value__.v_object);
+		object_data->private_data__ = native_ptr;
+		object_data->private_data_finalize_callback__ = nullptr;
+		object_data->private_data_finalize_function__ = finalize_function;
 	}
 
 	bool JSObject::HasProperty(const std::string& name) const {
@@ -118,29 +91,67 @@ namespace Daisy {
 	JSValue JSObject::GetProperty(const std::string& name) const {
 		jerry_api_value_t js_value;
 		if (jerry_api_get_object_field_value(js_api_value__.v_object, reinterpret_cast<const jerry_api_char_t *>(name.c_str()), &js_value)) {
+			return JSValue(js_context__, js_value);
+		}
+		return js_context__.CreateUndefined();
+	}
+
+	bool JSObject::HasProperty(const JSPropertyKey& key) const {
+		jerry_api_value_t js_value;
+		if (jerry_api_get_object_field_value_by_string(js_api_value__.v_object, key.get_api_string(), &js_value)) {
+			const auto has_property = (js_value.type != JERRY_API_DATA_TYPE_UNDEFINED);
 			jerry_api_release_value(&js_value);
+			return has_property;
+		}
+		return false;
+	}
+
+	JSValue JSObject::GetProperty(const JSPropertyKey& key) const {
+		jerry_api_value_t js_value;
+		if (jerry_api_get_object_field_value_by_string(js_api_value__.v_object, key.get_api_string(), &js_value)) {
 			return JSValue(js_context__, js_value);
 		}
 		return js_context__.CreateUndefined();
 	}
 
+	// The property slot keeps its own engine reference to the value, so
+	// nothing needs to be retained on the Daisy side.
+	void JSObject::SetProperty(const JSPropertyKey& key, JSValue js_value) {
+		auto value = static_cast<jerry_api_value_t>(js_value);
+		jerry_api_set_object_field_value_by_string(js_api_value__.v_object, key.get_api_string(), &value);
+	}
+
 	void JSObject::SetProperty(const std::string& name, JSValue js_value) {
 		auto value = static_cast<jerry_api_value_t>(js_value);
-		jerry_api_set_object_field_value(js_api_value__.v_object, reinterpret_cast<const jerry_api_char_t *>(name.c_str()), &value);
+		jerry_api_set_object_field_value_sz(js_api_value__.v_object, reinterpret_cast<const jerry_api_char_t *>(name.data()), static_cast<jerry_api_size_t>(name.size()), &value);
+	}
 
-		auto key = js_api_value__.v_object;
-		auto js_object_properties_pos = js_object_properties_map__.find(key);
-		std::unordered_map<std::string, JSValue> js_object_properties;
-		if (js_object_properties_pos != js_object_properties_map__.end()) {
-			js_object_properties = js_object_properties_pos->second;
+	void JSObject::SetProperties(std::initializer_list<std::pair<JSPropertyKey, JSValue>> properties) {
+		std::vector<jerry_api_string_t*> names;
+		std::vector<jerry_api_value_t>   values;
+		names.reserve(properties.size());
+		values.reserve(properties.size());
+		for (const auto& property : properties) {
+			names.push_back(property.first.get_api_string());
+			values.push_back(static_cast<jerry_api_value_t>(property.second));
 		}
-		if (js_object_properties.find(name) != js_object_properties.end()) {
-			js_object_properties.erase(name);
+		jerry_api_set_object_field_values(js_api_value__.v_object, names.data(), values.data(), static_cast<jerry_api_length_t>(names.size()));
+	}
+
+	void JSObject::SetProperties(std::initializer_list<std::pair<std::string, JSValue>> properties) {
+		std::vector<jerry_api_string_t*> names;
+		std::vector<jerry_api_value_t>   values;
+		names.reserve(properties.size());
+		values.reserve(properties.size());
+		for (const auto& property : properties) {
+			const auto& name = property.first;
+			names.push_back(jerry_api_create_string_sz(reinterpret_cast<const jerry_api_char_t *>(name.data()), static_cast<jerry_api_size_t>(name.size())));
+			values.push_back(static_cast<jerry_api_value_t>(property.second));
+		}
+		jerry_api_set_object_field_values(js_api_value__.v_object, names.data(), values.data(), static_cast<jerry_api_length_t>(names.size()));
+		for (const auto name : names) {
+			jerry_api_release_string(name);
 		}
-		assert(js_object_properties.find(name) == js_object_properties.end());
-
-		js_object_properties.emplace(name, js_value); // to prevent from GC
-		js_object_properties_map__[key] = js_object_properties;
 	}
 
 	JSObject::JSObject(const JSContext& js_context) DAISY_NOEXCEPT 
@@ -155,11 +166,15 @@ namespace Daisy {
 	}
 	
 	JSObject::JSObject(const JSObject& rhs) DAISY_NOEXCEPT 
-		: JSValue(rhs.js_context__, rhs.js_api_value__) {
+		: JSValue(rhs) {
 	}
 	
 	JSObject::JSObject(JSObject&& rhs) DAISY_NOEXCEPT
-		: JSValue(rhs.js_context__, rhs.js_api_value__) {
+		: JSValue(std::move(rhs)) {
+	}
+
+	JSObject::JSObject(const JSValue& js_value) DAISY_NOEXCEPT
+		: JSValue(js_value) {
 	}
 
 	JSObject::JSObject(const JSContext& js_context, const jerry_api_value_t& js_api_value) DAISY_NOEXCEPT 
@@ -173,14 +188,10 @@ namespace Daisy {
 	JSObject JSObject::CallAsConstructor(const std::vector<JSValue>&  arguments) {
 		DAISY_JSOBJECT_LOCK_GUARD;
 		assert(IsConstructor());
-		bool status = false;
+		const detail::JSContextScope js_context_scope(js_context__);
 		jerry_api_value_t js_api_value;
-		if (arguments.empty()) {
-			status = jerry_api_construct_object(js_api_value__.v_object, &js_api_value, NULL, 0);
-		} else {
-			const auto arguments_array = detail::to_vector(arguments);
-			status = jerry_api_construct_object(js_api_value__.v_object, &js_api_value, &arguments_array[0], arguments_array.size());
-		}
+		const detail::JSApiValueArray arguments_array(arguments);
+		const bool status = jerry_api_construct_object(js_api_value__.v_object, &js_api_value, arguments_array.data(), arguments_array.size());
 		if (!status) {
 			// TODO: throw runtime exception
 		}
@@ -191,15 +202,11 @@ namespace Daisy {
 		DAISY_JSOBJECT_LOCK_GUARD;
 		assert(this_object.IsObject());
 		assert(IsFunction());
-		bool status = false;
 		jerry_api_value_t js_api_value;
 		js_api_value.type = JERRY_API_DATA_TYPE_UNDEFINED;
-		if (arguments.empty()) {
-			status = jerry_api_call_function(js_api_value__.v_object, static_cast<jerry_api_value_t>(this_object).v_object, &js_api_value, NULL, 0);
-		} else {
-			const auto arguments_array = detail::to_vector(arguments);
-			status = jerry_api_call_function(js_api_value__.v_object, static_cast<jerry_api_value_t>(this_object).v_object, &js_api_value, &arguments_array[0], arguments_array.size());
-		}
+		const detail::JSContextScope js_context_scope(js_context__);
+		const detail::JSApiValueArray arguments_array(arguments);
+		const bool status = jerry_api_call_function(js_api_value__.v_object, static_cast<jerry_api_value_t>(this_object).v_object, &js_api_value, arguments_array.data(), arguments_array.size());
 		if (!status) {
 			std::cout << "[ERROR JSObject::CallAsFunction FAILED" << std::endl;
 		}
@@ -208,8 +215,18 @@ namespace Daisy {
 
 	std::vector<std::string> JSObject::GetPropertyNames() const DAISY_NOEXCEPT {
 		DAISY_JSOBJECT_LOCK_GUARD;
-		// TODO:
-		return std::vector<std::string>();	
+		std::vector<std::string> names;
+		jerry_api_foreach_object_field_name(js_api_value__.v_object, [](const jerry_api_string_t* field_name, void* user_data) {
+			jerry_api_value_t js_api_name;
+			js_api_name.type = JERRY_API_DATA_TYPE_STRING;
+			js_api_name.v_string = const_cast<jerry_api_string_t*>(field_name);
+
+			auto& names = *static_cast<std::vector<std::string>*>(user_data);
+			names.emplace_back();
+			JSString::ToString(js_api_name, names.back());
+			return true;
+		}, &names);
+		return names;
 	}
 
 	JSValue JSObject::operator()(const std::vector<JSValue>&  arguments, JSObject this_object) {
@@ -0,0 +1,46 @@
+/**
+ * Copyright (c) 2015 by Kota Iguchi. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+#include "Daisy/JSPropertyKey.hpp"
+
+namespace Daisy {
+
+	JSPropertyKey::JSPropertyKey(const JSString& js_name) DAISY_NOEXCEPT
+		: js_name__(js_name) {
+	}
+
+	JSPropertyKey::operator std::string() const DAISY_NOEXCEPT {
+		return static_cast<std::string>(js_name__);
+	}
+
+	std::size_t JSPropertyKey::hash_value() const {
+		return js_name__.hash_value();
+	}
+
+	JSPropertyKey::~JSPropertyKey() DAISY_NOEXCEPT {
+	}
+
+	JSPropertyKey::JSPropertyKey(const JSPropertyKey& rhs) DAISY_NOEXCEPT
+		: js_name__(rhs.js_name__) {
+	}
+
+	JSPropertyKey::JSPropertyKey(JSPropertyKey&& rhs) DAISY_NOEXCEPT
+		: js_name__(std::move(rhs.js_name__)) {
+	}
+
+	JSPropertyKey& JSPropertyKey::operator=(JSPropertyKey rhs) DAISY_NOEXCEPT {
+		swap(rhs);
+		return *this;
+	}
+
+	void JSPropertyKey::swap(JSPropertyKey& other) DAISY_NOEXCEPT {
+		js_name__.swap(other.js_name__);
+	}
+
+	bool operator==(const JSPropertyKey& lhs, const JSPropertyKey& rhs) {
+		return lhs.js_name__ == rhs.js_name__;
+	}
+
+} // namespace Daisy {
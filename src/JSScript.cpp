@@ -0,0 +1,61 @@
+/**
+ * Copyright (c) 2015 by Kota Iguchi. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+#include "Daisy/JSScript.hpp"
+#include "Daisy/JSValue.hpp"
+
+namespace Daisy {
+
+	JSScript::JSScript(const JSContext& js_context, const jerry_api_script_t* js_api_script) DAISY_NOEXCEPT
+		: js_context__(js_context)
+		, js_api_script__(js_api_script) {
+		if (js_api_script__ != nullptr) {
+			jerry_api_acquire_script(js_api_script__);
+		}
+	}
+
+	JSValue JSScript::Run() const {
+		return js_context__.JSEvaluateScript(*this);
+	}
+
+	std::vector<std::uint8_t> JSScript::CreateSnapshot() const {
+		std::vector<std::uint8_t> snapshot;
+		if (IsCompiled()) {
+			snapshot.resize(jerry_api_save_snapshot(js_api_script__, nullptr, 0));
+			jerry_api_save_snapshot(js_api_script__, snapshot.data(), snapshot.size());
+		}
+		return snapshot;
+	}
+
+	JSScript::~JSScript() DAISY_NOEXCEPT {
+		if (js_api_script__ != nullptr) {
+			jerry_api_release_script(js_api_script__);
+		}
+	}
+
+	JSScript::JSScript(const JSScript& rhs) DAISY_NOEXCEPT
+		: js_context__(rhs.js_context__)
+		, js_api_script__(rhs.js_api_script__) {
+		if (js_api_script__ != nullptr) {
+			jerry_api_acquire_script(js_api_script__);
+		}
+	}
+
+	JSScript::JSScript(JSScript&& rhs) DAISY_NOEXCEPT
+		: js_context__(std::move(rhs.js_context__))
+		, js_api_script__(rhs.js_api_script__) {
+		rhs.js_api_script__ = nullptr;
+	}
+
+	JSScript& JSScript::operator=(JSScript rhs) DAISY_NOEXCEPT {
+		swap(rhs);
+		return *this;
+	}
+
+	void JSScript::swap(JSScript& other) DAISY_NOEXCEPT {
+		std::swap(js_api_script__, other.js_api_script__);
+	}
+
+} // namespace Daisy {
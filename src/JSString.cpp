@@ -16,27 +16,36 @@ namespace Daisy {
 	}
 
 	std::string JSString::ToString(const jerry_api_value_t& js_api_value) DAISY_NOEXCEPT {
-		assert(js_api_value.type == JERRY_API_DATA_TYPE_STRING);
-		ssize_t neg_size = jerry_api_string_to_char_buffer(js_api_value.v_string, NULL, 0);
-		char*   buffer = static_cast<char*>(calloc(-neg_size, sizeof(char)));
-		jerry_api_string_to_char_buffer(js_api_value.v_string, reinterpret_cast<jerry_api_char_t *>(buffer), -neg_size);
-		const std::string result = buffer;
-		free(buffer);
+		std::string result;
+		ToString(js_api_value, result);
 		return result;
 	}
 
+	void JSString::ToString(const jerry_api_value_t& js_api_value, std::string& result) DAISY_NOEXCEPT {
+		assert(js_api_value.type == JERRY_API_DATA_TYPE_STRING);
+		const ssize_t neg_size = jerry_api_string_to_char_buffer(js_api_value.v_string, NULL, 0);
+		result.resize(static_cast<std::size_t>(-neg_size));
+		if (neg_size != 0) {
+			jerry_api_string_to_char_buffer(js_api_value.v_string, reinterpret_cast<jerry_api_char_t*>(&result[0]), -neg_size);
+		}
+	}
+
 	JSString::JSString(const JSContext& js_context, const jerry_api_value_t& js_api_value) DAISY_NOEXCEPT
-		: JSValue(js_context, js_api_value)
-		, string__(ToString(js_api_value)) {
-		std::hash<std::string> hash_function = std::hash<std::string>();
-		hash_value__ = hash_function(static_cast<std::string>(string__));
+		: JSValue(js_context, js_api_value) {
 	}
 
 	JSString::JSString(const JSContext& js_context, const std::string& value) DAISY_NOEXCEPT
 		: JSValue(js_context, MakeString(value))
-		, string__(value) {
-		std::hash<std::string> hash_function = std::hash<std::string>();
-		hash_value__ = hash_function(static_cast<std::string>(string__));
+		, string__(value)
+		, string_materialized__(true) {
+	}
+
+	const std::string& JSString::materialize() const DAISY_NOEXCEPT {
+		if (!string_materialized__) {
+			ToString(js_api_value__, string__);
+			string_materialized__ = true;
+		}
+		return string__;
 	}
 
 	const std::size_t JSString::length() const  DAISY_NOEXCEPT {
@@ -53,26 +62,63 @@ namespace Daisy {
 	}
 
 	JSString::operator std::string() const DAISY_NOEXCEPT {
-		return string__;
+		return materialize();
 	}
 
 	std::size_t JSString::hash_value() const {
+		if (!hash_computed__) {
+			hash_value__ = std::hash<std::string>()(materialize());
+			hash_computed__ = true;
+		}
 		return hash_value__;
 	}
 
+	std::size_t JSString::CopyTo(char* buffer, const std::size_t buffer_size) const DAISY_NOEXCEPT {
+		if (string_materialized__) {
+			if (buffer_size < string__.size()) {
+				return 0;
+			}
+			string__.copy(buffer, string__.size());
+			return string__.size();
+		}
+		if (buffer_size == 0) {
+			return 0;
+		}
+		const ssize_t copied = jerry_api_string_to_char_buffer(js_api_value__.v_string, reinterpret_cast<jerry_api_char_t*>(buffer), static_cast<ssize_t>(buffer_size));
+		return copied < 0 ? 0 : static_cast<std::size_t>(copied);
+	}
+
+	void JSString::CopyTo(std::string& value) const DAISY_NOEXCEPT {
+		if (string_materialized__) {
+			value.assign(string__);
+		} else {
+			ToString(js_api_value__, value);
+		}
+	}
+
 	JSString::~JSString() DAISY_NOEXCEPT {
 	}
 
+	JSString::JSString(const JSValue& js_value) DAISY_NOEXCEPT
+		: JSValue(js_value) {
+	}
+
 	JSString::JSString(const JSString& rhs) DAISY_NOEXCEPT
-		: JSValue(rhs.js_context__, rhs.js_api_value__)
+		: JSValue(rhs)
 		, string__(rhs.string__)
-		, hash_value__(rhs.hash_value__) {
+		, hash_value__(rhs.hash_value__)
+		, string_materialized__(rhs.string_materialized__)
+		, hash_computed__(rhs.hash_computed__) {
 	}
 
 	JSString::JSString(JSString&& rhs) DAISY_NOEXCEPT
-		: JSValue(rhs.js_context__, rhs.js_api_value__)
+		: JSValue(std::move(rhs))
 		, string__(std::move(rhs.string__))
-		, hash_value__(std::move(rhs.hash_value__)) {
+		, hash_value__(rhs.hash_value__)
+		, string_materialized__(rhs.string_materialized__)
+		, hash_computed__(rhs.hash_computed__) {
+		rhs.string_materialized__ = false;
+		rhs.hash_computed__       = false;
 	}
 
 	JSString& JSString::operator=(JSString rhs) DAISY_NOEXCEPT {
@@ -83,13 +129,21 @@ namespace Daisy {
 
 	void JSString::swap(JSString& other) DAISY_NOEXCEPT {
 		DAISY_JSSTRING_LOCK_GUARD;
-		std::swap(js_api_value__,  other.js_api_value__);
+		JSValue::swap(other);
 		std::swap(string__       , other.string__);
 		std::swap(hash_value__   , other.hash_value__);
+		std::swap(string_materialized__, other.string_materialized__);
+		std::swap(hash_computed__      , other.hash_computed__);
 	}
 
 	bool operator==(const JSString& lhs, const JSString& rhs) {
-		return (lhs.string__ == rhs.string__);
+		if (lhs.js_api_value__.v_string == rhs.js_api_value__.v_string) {
+			return true;
+		}
+		if (lhs.hash_computed__ && rhs.hash_computed__ && lhs.hash_value__ != rhs.hash_value__) {
+			return false;
+		}
+		return lhs.materialize() == rhs.materialize();
 	}
 
 } // namespace Daisy {
@@ -7,6 +7,7 @@
 #include "Daisy/JSValue.hpp"
 #include "Daisy/JSString.hpp"
 #include "Daisy/JSObject.hpp"
+#include "Daisy/JSHandleScope.hpp"
 #include <cassert>
 #include <sstream>
 
@@ -19,22 +20,35 @@ namespace Daisy {
 	JSValue::JSValue(const JSValue& rhs) DAISY_NOEXCEPT
 		: js_context__(rhs.js_context__)
 		, js_api_value__(rhs.js_api_value__)
-		, js_value_managed__(rhs.js_value_managed__) {
+		, js_value_managed__(rhs.js_value_managed__)
+		, js_api_value_retain_count__(rhs.js_api_value_retain_count__) {
 		retain();
 	}
 
 	JSValue::JSValue(JSValue&& rhs) DAISY_NOEXCEPT
-		: js_context__(rhs.js_context__)
+		: js_context__(std::move(rhs.js_context__))
 		, js_api_value__(rhs.js_api_value__)
-		, js_value_managed__(rhs.js_value_managed__) {
-		retain();
+		, js_value_managed__(rhs.js_value_managed__)
+		, js_api_value_retain_count__(rhs.js_api_value_retain_count__) {
+		// steal the reference and leave an empty value behind, so that
+		// the moved-from wrapper has nothing to release
+		rhs.js_api_value__.type = JERRY_API_DATA_TYPE_UNDEFINED;
+		rhs.js_api_value_retain_count__ = nullptr;
 	}
 
 	JSValue::JSValue(const JSContext& js_context, const jerry_api_value_t& js_api_value, const bool& managed) DAISY_NOEXCEPT
 		: js_context__(js_context)
 		, js_api_value__(js_api_value)
 		, js_value_managed__(managed) {
-		retain();
+		// The wrapper adopts the engine reference that comes with a managed
+		// string or object, unless an open handle scope takes it over.
+		if (managed && (IsString() || IsObject())) {
+			if (JSHandleScope::Adopt(js_api_value)) {
+				js_value_managed__ = false;
+			} else {
+				js_api_value_retain_count__ = new std::size_t(1);
+			}
+		}
 	}
 
 
@@ -83,19 +97,17 @@ namespace Daisy {
 			ss << number;
 			return ss.str();
 		} else if (IsString()) {
-			return static_cast<std::string>(JSString(js_context__, js_api_value__));
+			return JSString::ToString(js_api_value__);
 		}
 		return ""; // unknown
 	}
 
 	JSValue::operator JSString() const DAISY_NOEXCEPT {
-		return JSString(js_context__, js_api_value__);
+		return JSString(*this);
 	}
 
 	JSValue::operator JSObject() const DAISY_NOEXCEPT {
-		auto js_object = JSObject(js_context__, js_api_value__);
-		js_object.js_value_managed__ = js_value_managed__;
-		return js_object;
+		return JSObject(*this);
 	}
 
 	JSValue& JSValue::operator=(JSValue rhs) DAISY_NOEXCEPT {
@@ -109,79 +121,37 @@ namespace Daisy {
 		std::swap(js_context__, other.js_context__);
 		std::swap(js_api_value__, other.js_api_value__);
 		std::swap(js_value_managed__, other.js_value_managed__);
+		std::swap(js_api_value_retain_count__, other.js_api_value_retain_count__);
 	}
 
-	std::unordered_map<std::intptr_t, std::tuple<jerry_api_data_type_t, std::size_t>> JSValue::js_api_value_retain_count_map__;
-
 	void JSValue::retain() {
 		DAISY_JSVALUE_LOCK_GUARD_STATIC;
-
-		std::intptr_t key;
-		if (IsString()) {
-			key = reinterpret_cast<std::intptr_t>(js_api_value__.v_string);
-		} else if (IsObject()) {
-			key = reinterpret_cast<std::intptr_t>(js_api_value__.v_object);
-		} else {
-			return;
-		}
-		const auto position = js_api_value_retain_count_map__.find(key);
-		const bool found    = position != js_api_value_retain_count_map__.end();
-
-		if (found) {
-			auto tuple = position->second;
-			++std::get<1>(tuple);
-			js_api_value_retain_count_map__[key] = tuple;
-		} else {
-			const auto insert_result = js_api_value_retain_count_map__.emplace(key, std::make_tuple(js_api_value__.type, 1));
-			const bool inserted      = insert_result.second;
-
-			assert(inserted);
+		if (js_api_value_retain_count__) {
+			++(*js_api_value_retain_count__);
 		}
 	}
 
 	void JSValue::release() {
 		DAISY_JSVALUE_LOCK_GUARD_STATIC;
+		if (js_api_value_retain_count__ == nullptr) {
+			return;
+		}
 
-		std::intptr_t key;
-		if (IsString()) {
-			key = reinterpret_cast<std::intptr_t>(js_api_value__.v_string);
-		} else if (IsObject()) {
-			key = reinterpret_cast<std::intptr_t>(js_api_value__.v_object);
-		} else {
+		assert(*js_api_value_retain_count__ > 0);
+		if (--(*js_api_value_retain_count__) > 0) {
 			return;
 		}
 
-		const auto position = js_api_value_retain_count_map__.find(key);
-		const bool found    = position != js_api_value_retain_count_map__.end();
-
-		assert(found);
-
-		if (found) {
-			auto tuple = position->second;
-			--std::get<1>(tuple);
-			if (std::get<1>(tuple) == 0) {
-				js_api_value_retain_count_map__.erase(key);
-				const auto js_value_type = std::get<0>(tuple);
-				if (js_value_type == JERRY_API_DATA_TYPE_STRING) {
-					if (js_value_managed__) {
-						jerry_api_release_string(reinterpret_cast<jerry_api_string_t*>(key));
-					}
-				} else if (js_value_type == JERRY_API_DATA_TYPE_OBJECT) {
-					if (!IsGlobalObject()) {
-						const auto api_object_ptr = reinterpret_cast<jerry_api_object_t*>(key);
-						JSObject::js_object_external_functions_map__.erase(api_object_ptr);
-						JSObject::js_object_external_constructors_map__.erase(api_object_ptr);
-						JSObject::js_object_properties_map__.erase(api_object_ptr);
-						if (js_value_managed__) {
-							std::uintptr_t private_ptr;
-							jerry_api_get_object_native_handle(api_object_ptr, &private_ptr);
-							JSObject::FinalizePrivateData(private_ptr);
-							jerry_api_release_object(api_object_ptr);
-						}
-					}
-				}
-			} else {
-				js_api_value_retain_count_map__[key] = tuple;
+		delete js_api_value_retain_count__;
+		js_api_value_retain_count__ = nullptr;
+
+		if (IsString()) {
+			if (js_value_managed__) {
+				jerry_api_release_string(js_api_value__.v_string);
+			}
+		} else if (IsObject()) {
+			if (js_value_managed__) {
+				jerry_api_release_object(js_api_value__.v_object);
 			}
 		}
 	}
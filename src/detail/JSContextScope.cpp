@@ -0,0 +1,33 @@
+/**
+ * Copyright (c) 2015 by Kota Iguchi. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+#include "Daisy/detail/JSContextScope.hpp"
+#include "Daisy/JSContext.hpp"
+
+namespace Daisy { namespace detail {
+
+	static DAISY_THREAD_LOCAL const JSContext* js_current_context = nullptr;
+
+	JSContextScope::JSContextScope(const JSContext& js_context) DAISY_NOEXCEPT
+		: previous__(js_current_context) {
+		js_current_context = &js_context;
+	}
+
+	JSContextScope::~JSContextScope() DAISY_NOEXCEPT {
+		js_current_context = previous__;
+	}
+
+	const JSContext& JSContextScope::current() DAISY_NOEXCEPT {
+		if (js_current_context != nullptr) {
+			return *js_current_context;
+		}
+		// The engine was entered without a scope (e.g. a native accessor run
+		// from GetProperty). There's only one JSContext on Daisy, so any
+		// instance will do.
+		static DAISY_THREAD_LOCAL const JSContext js_default_context;
+		return js_default_context;
+	}
+
+}} // namespace Daisy { namespace detail {
@@ -0,0 +1,61 @@
+/**
+ * Copyright (c) 2015 by Kota Iguchi. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+#include "Daisy/detail/JSJobQueue.hpp"
+
+namespace Daisy { namespace detail {
+
+	JSJobQueue::JSJobQueue() DAISY_NOEXCEPT
+		: head__(&stub__)
+		, tail__(&stub__) {
+	}
+
+	JSJobQueue::~JSJobQueue() DAISY_NOEXCEPT {
+		while (const auto js_job = Pop()) {
+			delete js_job;
+		}
+	}
+
+	void JSJobQueue::Push(JSJob* js_job) DAISY_NOEXCEPT {
+		js_job->next__.store(nullptr, std::memory_order_relaxed);
+		// Producers only race on head__; the consumer sees the job once
+		// the previous head links to it.
+		const auto previous = head__.exchange(js_job, std::memory_order_acq_rel);
+		previous->next__.store(js_job, std::memory_order_release);
+	}
+
+	JSJob* JSJobQueue::Pop() DAISY_NOEXCEPT {
+		auto tail = tail__;
+		auto next = tail->next__.load(std::memory_order_acquire);
+
+		if (tail == &stub__) {
+			if (next == nullptr) {
+				return nullptr;
+			}
+			tail__ = next;
+			tail   = next;
+			next   = next->next__.load(std::memory_order_acquire);
+		}
+
+		if (next != nullptr) {
+			tail__ = next;
+			return tail;
+		}
+
+		if (tail != head__.load(std::memory_order_acquire)) {
+			return nullptr;
+		}
+
+		// tail is the last job; put the stub behind it so it can be taken.
+		Push(&stub__);
+		next = tail->next__.load(std::memory_order_acquire);
+		if (next != nullptr) {
+			tail__ = next;
+			return tail;
+		}
+		return nullptr;
+	}
+
+}} // namespace Daisy { namespace detail {
@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) 2015 by Kota Iguchi. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+#include "Daisy/detail/JSObjectData.hpp"
+#include <deque>
+
+namespace Daisy { namespace detail {
+
+	namespace {
+		struct JSFinalization {
+			std::uintptr_t           private_data;
+			JSObjectFinalizeCallback finalize_callback;
+			JSObjectFinalizeFunction finalize_function;
+
+			void operator()() const {
+				if (finalize_function) {
+					finalize_function(private_data);
+				} else if (finalize_callback) {
+					finalize_callback(private_data);
+				}
+			}
+		};
+
+		struct JSFinalizationQueue {
+			bool deferred { false };
+			std::deque<JSFinalization> finalizations;
+		};
+
+		DAISY_THREAD_LOCAL JSFinalizationQueue js_finalization_queue;
+	}
+
+	JSObjectData* JSObjectData::Get(const jerry_api_object_t* js_api_object) DAISY_NOEXCEPT {
+		std::uintptr_t handle;
+		if (jerry_api_get_object_native_handle(const_cast<jerry_api_object_t*>(js_api_object), &handle)) {
+			return reinterpret_cast<JSObjectData*>(handle);
+		}
+		return nullptr;
+	}
+
+	JSObjectData* JSObjectData::Ensure(jerry_api_object_t* js_api_object) DAISY_NOEXCEPT {
+		auto object_data = Get(js_api_object);
+		if (object_data == nullptr) {
+			object_data = new JSObjectData();
+			jerry_api_set_object_native_handle(js_api_object, reinterpret_cast<std::uintptr_t>(object_data), Free);
+		}
+		return object_data;
+	}
+
+	void JSObjectData::Free(const std::uintptr_t native_ptr) {
+		const auto object_data = reinterpret_cast<JSObjectData*>(native_ptr);
+		JSFinalization finalization {
+			object_data->private_data__,
+			std::move(object_data->private_data_finalize_callback__),
+			object_data->private_data_finalize_function__
+		};
+		delete object_data;
+
+		if (!finalization.finalize_callback && !finalization.finalize_function) {
+			return;
+		}
+		if (js_finalization_queue.deferred) {
+			js_finalization_queue.finalizations.push_back(std::move(finalization));
+		} else {
+			finalization();
+		}
+	}
+
+	void JSObjectData::SetFinalizationDeferred(const bool deferred) DAISY_NOEXCEPT {
+		js_finalization_queue.deferred = deferred;
+	}
+
+	bool JSObjectData::IsFinalizationDeferred() DAISY_NOEXCEPT {
+		return js_finalization_queue.deferred;
+	}
+
+	std::size_t JSObjectData::GetPendingFinalizationCount() DAISY_NOEXCEPT {
+		return js_finalization_queue.finalizations.size();
+	}
+
+	std::size_t JSObjectData::DrainFinalizationQueue(const std::size_t max_count) {
+		auto& finalizations = js_finalization_queue.finalizations;
+		std::size_t count = 0;
+		// A finalizer may release values and queue more finalizations,
+		// so each one is taken off the queue before it runs.
+		while (count < max_count && !finalizations.empty()) {
+			const auto finalization = std::move(finalizations.front());
+			finalizations.pop_front();
+			finalization();
+			++count;
+		}
+		return count;
+	}
+
+}} // namespace Daisy { namespace detail {
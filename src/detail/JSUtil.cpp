@@ -22,11 +22,23 @@ namespace Daisy { namespace detail {
 	std::vector<JSValue> to_vector(const JSContext& js_context, const jerry_api_value_t arguments[], const jerry_api_length_t argumentCount) {
 		std::vector<JSValue> js_value_vector;
 		for (size_t i = 0; i < argumentCount; i++) {
-			js_value_vector.push_back(JSValue(js_context, arguments[i]));
+			js_value_vector.push_back(JSValue(js_context, js_jerry_api_value_acquire(arguments[i])));
 		}
 		return js_value_vector;
 	}
 
+	JSApiValueArray::JSApiValueArray(const std::vector<JSValue>& js_values) DAISY_NOEXCEPT
+		: data__(inline_values__)
+		, size__(static_cast<jerry_api_length_t>(js_values.size())) {
+		if (js_values.size() > inline_capacity) {
+			heap_values__.resize(js_values.size());
+			data__ = heap_values__.data();
+		}
+		for (std::size_t i = 0; i < js_values.size(); i++) {
+			data__[i] = static_cast<jerry_api_value_t>(js_values[i]);
+		}
+	}
+
 	void js_jerry_api_value_make_copy(const jerry_api_value_t& from, jerry_api_value_t* to) {
 		to->type   = from.type;
 		if (from.type == JERRY_API_DATA_TYPE_BOOLEAN) {
@@ -44,4 +56,23 @@ namespace Daisy { namespace detail {
 		}
 	}
 
+	jerry_api_value_t js_jerry_api_value_acquire(const jerry_api_value_t& js_api_value) {
+		jerry_api_value_t acquired = js_api_value;
+		if (js_api_value.type == JERRY_API_DATA_TYPE_STRING) {
+			acquired.v_string = jerry_api_acquire_string(js_api_value.v_string);
+		} else if (js_api_value.type == JERRY_API_DATA_TYPE_OBJECT) {
+			acquired.v_object = jerry_api_acquire_object(js_api_value.v_object);
+		}
+		return acquired;
+	}
+
+	std::string to_string(const jerry_api_string_t* js_api_string) {
+		const auto size = -jerry_api_string_to_char_buffer(js_api_string, nullptr, 0);
+		std::string result(static_cast<std::size_t>(size), '\0');
+		if (size != 0) {
+			jerry_api_string_to_char_buffer(js_api_string, reinterpret_cast<jerry_api_char_t*>(&result[0]), size);
+		}
+		return result;
+	}
+
 }} // namespace Daisy { namespace detail {
\ No newline at end of file
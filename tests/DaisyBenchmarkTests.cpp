@@ -0,0 +1,645 @@
+/**
+ * Copyright (c) 2015 by Kota Iguchi. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+#include "gtest/gtest.h"
+
+#define XCTAssertEqual    ASSERT_EQ
+#define XCTAssertNotEqual ASSERT_NE
+#define XCTAssertTrue     ASSERT_TRUE
+#define XCTAssertFalse    ASSERT_FALSE
+
+#include "Daisy/daisy.hpp"
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <thread>
+
+using namespace Daisy;
+
+namespace {
+	template<typename F>
+	double measure_nanoseconds_per_iteration(const std::size_t iterations, F f) {
+		const auto start = std::chrono::steady_clock::now();
+		for (std::size_t i = 0; i < iterations; i++) {
+			f();
+		}
+		const auto elapsed = std::chrono::steady_clock::now() - start;
+		return std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+	}
+
+	void report(const std::string& name, const double nanoseconds) {
+		std::cout << "[ BENCH    ] " << name << ": " << nanoseconds << " ns" << std::endl;
+	}
+
+	class Adder : public JSExportObject, public JSExport<Adder> {
+	public:
+		Adder(const JSContext& js_context) DAISY_NOEXCEPT
+			: JSExportObject(js_context) {
+		}
+
+		static void JSExportInitialize() {
+			JSExport<Adder>::AddFunctionProperty("addArguments", std::mem_fn(&Adder::addArguments));
+			JSExport<Adder>::AddFunction("addTyped", &Adder::addTyped);
+		}
+
+		JSValue addArguments(const JSArguments& arguments, JSObject& this_object) {
+			return this_object.get_context().CreateNumber(static_cast<double>(arguments[0]) + static_cast<double>(arguments[1]));
+		}
+
+		double addTyped(double a, double b) {
+			return a + b;
+		}
+	};
+}
+
+TEST(DaisyBenchmarkTests, JSValueVectorCopy) {
+	JSContextGroup js_context_group;
+	auto js_context = js_context_group.CreateContext();
+
+	std::vector<JSValue> values;
+	for (std::uint32_t i = 0; i < 64; i++) {
+		values.push_back(js_context.CreateObject());
+		values.push_back(js_context.CreateString("JSValueVectorCopy"));
+	}
+
+	std::size_t copied = 0;
+	const auto nanoseconds = measure_nanoseconds_per_iteration(2000, [&]() {
+		std::vector<JSValue> copy = values;
+		copied += copy.size();
+	});
+	report("JSValue vector copy (128 elements)", nanoseconds);
+	XCTAssertEqual(2000u * values.size(), copied);
+}
+
+TEST(DaisyBenchmarkTests, GetPropertyByKey) {
+	JSContextGroup js_context_group;
+	auto js_context = js_context_group.CreateContext();
+	auto js_object  = js_context.CreateObject();
+	js_object.SetProperty("benchmarkProperty", js_context.CreateNumber(1));
+
+	const auto key = js_context.CreatePropertyKey("benchmarkProperty");
+
+	double sum = 0;
+	const auto by_name = measure_nanoseconds_per_iteration(20000, [&]() {
+		sum += static_cast<double>(js_object.GetProperty("benchmarkProperty"));
+	});
+	report("GetProperty(std::string)", by_name);
+
+	const auto by_key = measure_nanoseconds_per_iteration(20000, [&]() {
+		sum += static_cast<double>(js_object.GetProperty(key));
+	});
+	report("GetProperty(JSPropertyKey)", by_key);
+
+	XCTAssertEqual(40000, sum);
+}
+
+TEST(DaisyBenchmarkTests, SetPropertyManyFields) {
+	JSContextGroup js_context_group;
+	auto js_context = js_context_group.CreateContext();
+
+	std::vector<std::string> names;
+	for (std::uint32_t i = 0; i < 1000; i++) {
+		names.push_back("field" + std::to_string(i));
+	}
+
+	const auto nanoseconds = measure_nanoseconds_per_iteration(5, [&]() {
+		auto js_object = js_context.CreateObject();
+		for (const auto& name : names) {
+			js_object.SetProperty(name, js_context.CreateNumber(1));
+		}
+	});
+	report("SetProperty x 1000 fields", nanoseconds);
+}
+
+TEST(DaisyBenchmarkTests, NativeFunctionCall) {
+	JSContextGroup js_context_group;
+	auto js_context = js_context_group.CreateContext();
+
+	JSClass js_class;
+	auto js_function = js_class.JSObjectMakeFunctionWithCallback(js_context, "add", [](JSObject, JSObject this_object, const JSArguments& arguments) {
+		return this_object.get_context().CreateNumber(static_cast<double>(arguments[0]) + static_cast<double>(arguments[1]));
+	});
+
+	const std::vector<JSValue> arguments { js_context.CreateNumber(1), js_context.CreateNumber(2) };
+	auto this_object = js_context.get_global_object();
+
+	double sum = 0;
+	const auto nanoseconds = measure_nanoseconds_per_iteration(20000, [&]() {
+		sum += static_cast<double>(js_function(arguments, this_object));
+	});
+	report("Native function call (2 arguments)", nanoseconds);
+	XCTAssertEqual(60000, sum);
+}
+
+TEST(DaisyBenchmarkTests, EvaluateCompiledScript) {
+	JSContextGroup js_context_group;
+	auto js_context = js_context_group.CreateContext();
+
+	const std::string source = "var total = 0; for (var i = 0; i < 10; i++) { total += i; } total;";
+
+	double sum = 0;
+	const auto by_source = measure_nanoseconds_per_iteration(200, [&]() {
+		sum += static_cast<double>(js_context.JSEvaluateScript(source));
+	});
+	report("JSEvaluateScript(std::string)", by_source);
+
+	const auto js_script = js_context.CreateScript(source);
+	const auto by_script = measure_nanoseconds_per_iteration(2000, [&]() {
+		sum += static_cast<double>(js_script.Run());
+	});
+	report("JSScript::Run", by_script);
+
+	XCTAssertEqual(2200 * 45, sum);
+}
+
+TEST(DaisyBenchmarkTests, EvaluateSnapshot) {
+	JSContextGroup js_context_group;
+	auto js_context = js_context_group.CreateContext();
+
+	std::string source;
+	for (std::uint32_t i = 0; i < 20; i++) {
+		source += "function f" + std::to_string(i) + "(a, b) { var s = 'f" + std::to_string(i) + "'; return a * b + s.length; }\n";
+	}
+	source += "f0(2, 3);";
+
+	const auto snapshot = js_context.CreateScript(source).CreateSnapshot();
+
+	double sum = 0;
+	const auto by_source = measure_nanoseconds_per_iteration(50, [&]() {
+		sum += static_cast<double>(js_context.JSEvaluateScript(source));
+	});
+	report("JSEvaluateScript(std::string), 20 functions", by_source);
+
+	const auto by_snapshot = measure_nanoseconds_per_iteration(50, [&]() {
+		sum += static_cast<double>(js_context.EvaluateSnapshot(snapshot.data(), snapshot.size()));
+	});
+	report("EvaluateSnapshot, 20 functions", by_snapshot);
+
+	XCTAssertEqual(100 * 8, sum);
+}
+
+TEST(DaisyBenchmarkTests, GetPropertyNames) {
+	JSContextGroup js_context_group;
+	auto js_context = js_context_group.CreateContext();
+	auto js_object  = js_context.CreateObject();
+	for (std::uint32_t i = 0; i < 16; i++) {
+		js_object.SetProperty("field" + std::to_string(i), js_context.CreateNumber(i));
+	}
+	js_context.get_global_object().SetProperty("benchmarkObject", js_object);
+
+	std::size_t count = 0;
+	const auto by_script = measure_nanoseconds_per_iteration(200, [&]() {
+		count += static_cast<std::size_t>(static_cast<double>(js_context.JSEvaluateScript("Object.keys(benchmarkObject).length;")));
+	});
+	report("Object.keys through JSEvaluateScript (16 fields)", by_script);
+
+	const auto native = measure_nanoseconds_per_iteration(200, [&]() {
+		count += js_object.GetPropertyNames().size();
+	});
+	report("GetPropertyNames (16 fields)", native);
+
+	js_context.get_global_object().SetProperty("benchmarkObject", js_context.CreateUndefined());
+	XCTAssertEqual(400u * 16, count);
+}
+
+TEST(DaisyBenchmarkTests, TypedFunctionBinding) {
+	JSContextGroup js_context_group;
+	auto js_context = js_context_group.CreateContext();
+	auto adder = js_context.CreateObject(JSExport<Adder>::Class());
+
+	auto add_arguments = static_cast<JSObject>(adder.GetProperty("addArguments"));
+	auto add_typed     = static_cast<JSObject>(adder.GetProperty("addTyped"));
+	const std::vector<JSValue> arguments { js_context.CreateNumber(1), js_context.CreateNumber(2) };
+
+	double sum = 0;
+	const auto untyped = measure_nanoseconds_per_iteration(20000, [&]() {
+		sum += static_cast<double>(add_arguments(arguments, adder));
+	});
+	report("JSExport AddFunctionProperty (2 arguments)", untyped);
+
+	const auto typed = measure_nanoseconds_per_iteration(20000, [&]() {
+		sum += static_cast<double>(add_typed(arguments, adder));
+	});
+	report("JSExport AddFunction (2 arguments)", typed);
+
+	XCTAssertEqual(120000, sum);
+}
+
+TEST(DaisyBenchmarkTests, CreateExportedObject) {
+	JSContextGroup js_context_group;
+	auto js_context = js_context_group.CreateContext();
+
+	std::size_t created = 0;
+	const auto nanoseconds = measure_nanoseconds_per_iteration(1000, [&]() {
+		auto adder = js_context.CreateObject(JSExport<Adder>::Class());
+		created += adder.IsObject() ? 1 : 0;
+	});
+	report("CreateObject(JSExport class with 2 functions)", nanoseconds);
+	XCTAssertEqual(1000u, created);
+}
+
+TEST(DaisyBenchmarkTests, SlabAllocator) {
+	struct Peer {
+		double values[4];
+	};
+
+	std::vector<Peer*> peers(256);
+
+	std::allocator<Peer> heap_allocator;
+	const auto heap = measure_nanoseconds_per_iteration(200, [&]() {
+		for (auto& peer : peers) {
+			peer = heap_allocator.allocate(1);
+		}
+		for (auto& peer : peers) {
+			heap_allocator.deallocate(peer, 1);
+		}
+	});
+	report("std::allocator allocate/deallocate x 256", heap);
+
+	JSSlabAllocator<Peer> slab_allocator;
+	const auto slab = measure_nanoseconds_per_iteration(200, [&]() {
+		for (auto& peer : peers) {
+			peer = slab_allocator.allocate(1);
+		}
+		for (auto& peer : peers) {
+			slab_allocator.deallocate(peer, 1);
+		}
+	});
+	report("JSSlabAllocator allocate/deallocate x 256", slab);
+}
+
+TEST(DaisyBenchmarkTests, ExportObjectGetObject) {
+	JSContextGroup js_context_group;
+	auto js_context = js_context_group.CreateContext();
+
+	std::vector<JSObject> adders;
+	for (std::uint32_t i = 0; i < 256; i++) {
+		adders.push_back(js_context.CreateObject(JSExport<Adder>::Class()));
+	}
+	auto adder_ptr = adders.back().GetPrivate<Adder>();
+
+	std::size_t found = 0;
+	const auto nanoseconds = measure_nanoseconds_per_iteration(20000, [&]() {
+		found += adder_ptr->get_object().IsObject() ? 1 : 0;
+	});
+	report("JSExportObject::get_object (256 live objects)", nanoseconds);
+	XCTAssertEqual(20000u, found);
+}
+
+TEST(DaisyBenchmarkTests, DeferredFinalization) {
+	JSContextGroup js_context_group;
+	auto js_context = js_context_group.CreateContext();
+
+	const auto create_peers = [&js_context]() {
+		for (std::uint32_t i = 0; i < 64; i++) {
+			auto js_object = js_context.CreateObject();
+			auto buffer = new std::vector<char>(64 * 1024, 1);
+			js_object.SetPrivate(reinterpret_cast<std::uintptr_t>(buffer), [](const std::uintptr_t& native_ptr) {
+				delete reinterpret_cast<std::vector<char>*>(native_ptr);
+			});
+		}
+	};
+
+	js_context.JSGarbageCollect();
+	create_peers();
+	const auto synchronous = measure_nanoseconds_per_iteration(1, [&]() {
+		js_context.JSGarbageCollect();
+	});
+	report("JSGarbageCollect, 64 peers finalized synchronously", synchronous);
+
+	js_context.set_deferred_finalization_enabled(true);
+	create_peers();
+	const auto deferred = measure_nanoseconds_per_iteration(1, [&]() {
+		js_context.JSGarbageCollect();
+	});
+	report("JSGarbageCollect, 64 peers deferred", deferred);
+	XCTAssertEqual(64u, js_context.get_pending_finalization_count());
+
+	const auto drain = measure_nanoseconds_per_iteration(1, [&]() {
+		js_context.DrainFinalizationQueue();
+	});
+	report("DrainFinalizationQueue, 64 peers", drain);
+	XCTAssertEqual(0u, js_context.get_pending_finalization_count());
+}
+
+TEST(DaisyBenchmarkTests, ContextExecutor) {
+	JSContextGroup js_context_group;
+	auto js_context = js_context_group.CreateContext();
+
+	const std::size_t job_count = 20000;
+	std::vector<std::future<std::size_t>> results(job_count);
+
+	std::mutex mutex;
+	std::deque<std::packaged_task<std::size_t(JSContext&)>> locked_queue;
+	const auto locked = measure_nanoseconds_per_iteration(1, [&]() {
+		for (std::size_t i = 0; i < job_count; i++) {
+			std::packaged_task<std::size_t(JSContext&)> job([i](JSContext&) { return i; });
+			results[i] = job.get_future();
+			std::lock_guard<std::mutex> lock(mutex);
+			locked_queue.push_back(std::move(job));
+		}
+		for (;;) {
+			std::packaged_task<std::size_t(JSContext&)> job;
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				if (locked_queue.empty()) {
+					break;
+				}
+				job = std::move(locked_queue.front());
+				locked_queue.pop_front();
+			}
+			job(js_context);
+		}
+	}) / job_count;
+	report("std::mutex + std::deque<std::packaged_task>, per job", locked);
+
+	std::size_t sum = 0;
+	for (auto& result : results) {
+		sum += result.get();
+	}
+
+	JSContextExecutor js_executor(js_context);
+	const auto lock_free = measure_nanoseconds_per_iteration(1, [&]() {
+		for (std::size_t i = 0; i < job_count; i++) {
+			results[i] = js_executor.Post([i](JSContext&) { return i; });
+		}
+		js_executor.RunPending();
+	}) / job_count;
+	report("JSContextExecutor::Post, per job", lock_free);
+
+	std::size_t dispatched = 0;
+	const auto dispatch = measure_nanoseconds_per_iteration(1, [&]() {
+		for (std::size_t i = 0; i < job_count; i++) {
+			js_executor.Dispatch([&dispatched](JSContext&) { ++dispatched; });
+		}
+		js_executor.RunPending();
+	}) / job_count;
+	report("JSContextExecutor::Dispatch, per job", dispatch);
+	XCTAssertEqual(job_count, dispatched);
+
+	for (auto& result : results) {
+		sum += result.get();
+	}
+	XCTAssertEqual(job_count * (job_count - 1), sum);
+}
+
+TEST(DaisyBenchmarkTests, EventLoopTimers) {
+	JSContextGroup js_context_group;
+	auto js_context = js_context_group.CreateContext();
+
+	const std::uint32_t timer_count = 10000;
+	std::size_t fired = 0;
+	const auto task = [&fired](JSContext&) { ++fired; };
+
+	// The bookkeeping embedders usually write: timers ordered by expiry,
+	// plus an index to cancel them by id.
+	typedef std::multimap<std::uint64_t, std::function<void(JSContext&)>> timer_map;
+	timer_map timers;
+	std::unordered_map<std::uint32_t, timer_map::iterator> timer_ids;
+	const auto ordered = measure_nanoseconds_per_iteration(1, [&]() {
+		for (std::uint32_t i = 0; i < timer_count; i++) {
+			timer_ids.emplace(i + 1, timers.emplace((i * 7919) % 5000, task));
+		}
+		for (std::uint32_t i = 0; i < timer_count; i += 2) {
+			const auto position = timer_ids.find(i + 1);
+			timers.erase(position->second);
+			timer_ids.erase(position);
+		}
+	}) / timer_count;
+	report("std::multimap timers, schedule + cancel half", ordered);
+
+	JSEventLoop js_event_loop(js_context);
+	std::vector<std::uint32_t> timer_handles(timer_count);
+	const auto wheel = measure_nanoseconds_per_iteration(1, [&]() {
+		for (std::uint32_t i = 0; i < timer_count; i++) {
+			timer_handles[i] = js_event_loop.SetTimeout(task, std::chrono::milliseconds((i * 7919) % 5000));
+		}
+		for (std::uint32_t i = 0; i < timer_count; i += 2) {
+			js_event_loop.ClearTimer(timer_handles[i]);
+		}
+	}) / timer_count;
+	report("JSEventLoop timers, schedule + cancel half", wheel);
+
+	XCTAssertEqual(timer_count / 2, timers.size());
+	XCTAssertTrue(js_event_loop.HasPendingTasks());
+	XCTAssertEqual(0u, fired);
+}
+
+TEST(DaisyBenchmarkTests, CreateArray) {
+	JSContextGroup js_context_group;
+	auto js_context = js_context_group.CreateContext();
+
+	std::vector<double> samples;
+	for (std::uint32_t i = 0; i < 1000; i++) {
+		samples.push_back(i * 0.25);
+	}
+
+	const auto set_properties = measure_nanoseconds_per_iteration(5, [&]() {
+		auto js_array = static_cast<JSObject>(js_context.JSEvaluateScript("[];"));
+		for (std::uint32_t i = 0; i < samples.size(); i++) {
+			js_array.SetProperty(std::to_string(i), js_context.CreateNumber(samples[i]));
+		}
+	});
+	report("Create an array of 1000 numbers with SetProperty", set_properties);
+
+	const auto create_array = measure_nanoseconds_per_iteration(5, [&]() {
+		js_context.CreateArray(samples);
+	});
+	report("Create an array of 1000 numbers with CreateArray", create_array);
+
+	const auto js_array = js_context.CreateArray(samples);
+	double sum = 0;
+	const auto get_properties = measure_nanoseconds_per_iteration(5, [&]() {
+		const auto length = static_cast<std::uint32_t>(js_array.GetProperty("length"));
+		std::vector<double> values;
+		values.reserve(length);
+		for (std::uint32_t i = 0; i < length; i++) {
+			values.push_back(static_cast<double>(js_array.GetProperty(std::to_string(i))));
+		}
+		sum += values.back();
+	});
+	report("Read an array of 1000 numbers with GetProperty", get_properties);
+
+	const auto to_vector = measure_nanoseconds_per_iteration(5, [&]() {
+		sum += js_array.ToVector<double>().back();
+	});
+	report("Read an array of 1000 numbers with ToVector", to_vector);
+
+	XCTAssertEqual(10 * 249.75, sum);
+}
+
+TEST(DaisyBenchmarkTests, ValueConverter) {
+	JSContextGroup js_context_group;
+	auto js_context = js_context_group.CreateContext();
+
+	std::map<std::string, std::vector<double>> telemetry;
+	for (std::uint32_t i = 0; i < 10; i++) {
+		auto& series = telemetry["series" + std::to_string(i)];
+		for (std::uint32_t j = 0; j < 20; j++) {
+			series.push_back(i + j * 0.5);
+		}
+	}
+
+	std::size_t created = 0;
+	const auto set_properties = measure_nanoseconds_per_iteration(50, [&]() {
+		auto js_object = js_context.CreateObject();
+		for (const auto& entry : telemetry) {
+			auto js_series = js_context.CreateObject();
+			for (std::uint32_t j = 0; j < entry.second.size(); j++) {
+				js_series.SetProperty(std::to_string(j), js_context.CreateNumber(entry.second[j]));
+			}
+			js_series.SetProperty("length", js_context.CreateNumber(static_cast<std::uint32_t>(entry.second.size())));
+			js_object.SetProperty(entry.first, js_series);
+		}
+		created += js_object.IsObject() ? 1 : 0;
+	});
+	report("Create 10 series of 20 numbers with SetProperty", set_properties);
+
+	auto json_parse = static_cast<JSObject>(static_cast<JSObject>(js_context.get_global_object().GetProperty("JSON")).GetProperty("parse"));
+	const auto json = measure_nanoseconds_per_iteration(50, [&]() {
+		std::ostringstream text;
+		text << "{";
+		for (const auto& entry : telemetry) {
+			text << (entry.first == telemetry.begin()->first ? "\"" : ",\"") << entry.first << "\":[";
+			for (std::size_t j = 0; j < entry.second.size(); j++) {
+				text << (j == 0 ? "" : ",") << entry.second[j];
+			}
+			text << "]";
+		}
+		text << "}";
+		created += json_parse({ js_context.CreateString(text.str()) }, json_parse).IsObject() ? 1 : 0;
+	});
+	report("Create 10 series of 20 numbers with JSON.parse", json);
+
+	const auto converter = measure_nanoseconds_per_iteration(50, [&]() {
+		created += js_context.CreateValue(telemetry).IsObject() ? 1 : 0;
+	});
+	report("Create 10 series of 20 numbers with CreateValue", converter);
+
+	const auto js_telemetry = js_context.CreateValue(telemetry);
+	const auto to = measure_nanoseconds_per_iteration(50, [&]() {
+		created += js_telemetry.To<std::map<std::string, std::vector<double>>>().size() == 10 ? 1 : 0;
+	});
+	report("Read 10 series of 20 numbers with To", to);
+
+	XCTAssertEqual(200u, created);
+}
+
+TEST(DaisyBenchmarkTests, HandleScope) {
+	JSContextGroup js_context_group;
+	auto js_context = js_context_group.CreateContext();
+
+	auto js_object = js_context.CreateObject();
+	std::vector<JSPropertyKey> keys;
+	for (std::uint32_t i = 0; i < 100; i++) {
+		keys.push_back(js_context.CreatePropertyKey("field" + std::to_string(i)));
+		js_object.SetProperty(keys.back(), js_context.CreateString("value" + std::to_string(i)));
+	}
+
+	// Read every field into a vector, the way a callback gathers the
+	// values it works on, and copy the vector once.
+	std::vector<JSValue> values;
+	values.reserve(keys.size());
+	std::size_t read = 0;
+	const auto read_fields = [&]() {
+		values.clear();
+		for (const auto& key : keys) {
+			values.push_back(js_object.GetProperty(key));
+		}
+		const auto copy = values;
+		read += copy.size();
+	};
+
+	const auto unscoped = measure_nanoseconds_per_iteration(2000, [&]() {
+		read_fields();
+	});
+	report("Read 100 string fields", unscoped);
+
+	const auto scoped = measure_nanoseconds_per_iteration(2000, [&]() {
+		JSHandleScope js_handle_scope;
+		read_fields();
+		values.clear();
+	});
+	report("Read 100 string fields in a JSHandleScope", scoped);
+
+	std::size_t copied = 0;
+	read_fields();
+	const auto copy_unscoped = measure_nanoseconds_per_iteration(2000, [&]() {
+		const auto copy = values;
+		copied += copy.size();
+	});
+	report("Copy 100 string values", copy_unscoped);
+
+	{
+		JSHandleScope js_handle_scope;
+		read_fields();
+		const auto copy_scoped = measure_nanoseconds_per_iteration(2000, [&]() {
+			const auto copy = values;
+			copied += copy.size();
+		});
+		report("Copy 100 string values in a JSHandleScope", copy_scoped);
+		values.clear();
+	}
+
+	values.clear();
+	XCTAssertEqual(4002u * 100, read);
+	XCTAssertEqual(4000u * 100, copied);
+}
+
+TEST(DaisyBenchmarkTests, FragmentedHeap) {
+	JSContextGroup js_context_group;
+	auto js_context = js_context_group.CreateContext();
+
+	// Every other object stays alive, so the heap is left with many
+	// blocks in use and holes between them.
+	js_context.JSEvaluateScript(
+		"var kept = [];"
+		"for (var i = 0; i < 2000; i++) { var o = { index: i, name: 'item' + i }; if (i % 2 == 0) { kept.push(o); } }");
+
+	const std::string source =
+		"var count = 0;"
+		"function f(a, b, c, d) { return a + b + c + d; }"
+		"for (var i = 0; i < 200; i++) { var o = { index: i, name: 'temp' + i }; count += f(i, 1, 2, 3) > 0 ? 1 : 0; }"
+		"count;";
+
+	double sum = 0;
+	const auto nanoseconds = measure_nanoseconds_per_iteration(20, [&]() {
+		sum += static_cast<double>(js_context.JSEvaluateScript(source));
+	});
+	report("JSEvaluateScript on a fragmented heap (200 objects, 200 calls)", nanoseconds);
+
+	XCTAssertEqual(20 * 200, sum);
+}
+
+TEST(DaisyBenchmarkTests, PoolChurn) {
+	JSContextGroup js_context_group;
+	auto js_context = js_context_group.CreateContext();
+
+	// Objects kept alive fill many pools, so that freeing a chunk has to
+	// find its pool among them.
+	js_context.JSEvaluateScript(
+		"var kept = [];"
+		"for (var i = 0; i < 1500; i++) { kept.push({ index: i, value: i + 0.5 }); }");
+
+	// Every temporary object, property and number takes pool chunks and
+	// gives them back right away.
+	const std::string source =
+		"var sum = 0;"
+		"for (var i = 0; i < 500; i++) { var o = { a: i + 0.5, b: i * 0.5 }; sum += o.a - o.b * 2; }"
+		"sum;";
+
+	double sum = 0;
+	const auto nanoseconds = measure_nanoseconds_per_iteration(20, [&]() {
+		sum += static_cast<double>(js_context.JSEvaluateScript(source));
+	});
+	report("JSEvaluateScript with pool chunk churn (500 objects, 1000 numbers)", nanoseconds);
+
+	XCTAssertEqual(20 * 250, sum);
+}
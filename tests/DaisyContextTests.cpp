@@ -12,17 +12,31 @@
 
 #include "Daisy/daisy.hpp"
 #include <iostream>
+#include <thread>
+#include <algorithm>
+#include <fstream>
+#include <cstdio>
+#include <future>
+#include <stdexcept>
 
 using namespace Daisy;
 
 TEST(DaisyContextTests, ContextInit) {
   JSContextGroup js_context_group;
+  XCTAssertTrue(js_context_group.IsValid());
   auto js_context1 = js_context_group.CreateContext();
   auto js_context2 = js_context_group.CreateContext();
   // There's only one context in Daisy
   XCTAssertTrue(js_context1 == js_context2);
 }
 
+TEST(DaisyContextTests, ContextGroupHeapSize) {
+  JSContextGroup js_context_group(64 * 1024);
+  auto js_context = js_context_group.CreateContext();
+  auto js_value = js_context.JSEvaluateScript("var s = ''; for (var i = 0; i < 100; i++) { s += i; } s.length;");
+  XCTAssertEqual(190, static_cast<std::int32_t>(js_value));
+}
+
 TEST(DaisyContextTests, UIntNumberInit) {
   JSContextGroup js_context_group;
   auto js_context = js_context_group.CreateContext();
@@ -239,3 +253,542 @@ TEST(DaisyContextTests, GetProperty_String_retain) {
   XCTAssertEqual("GetProperty_String", static_cast<std::string>(js_property));
   global_object.SetProperty("GetProperty_String_retain", js_context.CreateUndefined());
 }
+
+TEST(DaisyContextTests, MoveSemantics) {
+  static_assert(std::is_nothrow_move_constructible<JSValue>::value,  "JSValue should be nothrow move constructible");
+  static_assert(std::is_nothrow_move_constructible<JSObject>::value, "JSObject should be nothrow move constructible");
+  static_assert(std::is_nothrow_move_constructible<JSString>::value, "JSString should be nothrow move constructible");
+
+  JSContextGroup js_context_group;
+  auto js_context = js_context_group.CreateContext();
+
+  auto js_string = js_context.CreateString("MoveSemantics");
+  auto js_string_moved = std::move(js_string);
+  XCTAssertTrue(js_string_moved.IsString());
+  XCTAssertEqual("MoveSemantics", static_cast<std::string>(js_string_moved));
+  XCTAssertTrue(js_string.IsUndefined());
+
+  auto js_object = js_context.CreateObject();
+  js_object.SetProperty("value", js_context.CreateNumber(1234));
+  auto js_object_moved = std::move(js_object);
+  XCTAssertTrue(js_object_moved.IsObject());
+  XCTAssertTrue(js_object.IsUndefined());
+  XCTAssertEqual(1234, static_cast<std::uint32_t>(js_object_moved.GetProperty("value")));
+
+  std::vector<JSValue> values;
+  for (std::uint32_t i = 0; i < 100; i++) {
+    values.push_back(js_context.CreateObject());
+  }
+  for (const auto& value : values) {
+    XCTAssertTrue(value.IsObject());
+  }
+}
+
+TEST(DaisyContextTests, StringCopyTo) {
+  JSContextGroup js_context_group;
+  auto js_context = js_context_group.CreateContext();
+  auto js_string = static_cast<JSString>(js_context.JSEvaluateScript("'StringCopyTo' + ' Test'"));
+  XCTAssertEqual(17u, js_string.size());
+
+  char buffer[32];
+  XCTAssertEqual(0u, js_string.CopyTo(buffer, 4));
+  XCTAssertEqual(17u, js_string.CopyTo(buffer, sizeof(buffer)));
+  XCTAssertEqual("StringCopyTo Test", std::string(buffer, 17));
+
+  std::string value = "previous contents";
+  js_string.CopyTo(value);
+  XCTAssertEqual("StringCopyTo Test", value);
+
+  auto js_other = js_context.CreateString("StringCopyTo Test");
+  XCTAssertEqual(js_string, js_other);
+  XCTAssertEqual(js_string.hash_value(), js_other.hash_value());
+  XCTAssertNotEqual(js_string, js_context.CreateString("StringCopyTo"));
+}
+
+TEST(DaisyContextTests, PropertyKey) {
+  JSContextGroup js_context_group;
+  auto js_context = js_context_group.CreateContext();
+  auto js_object = js_context.CreateObject();
+  const auto key = js_context.CreatePropertyKey("testKey");
+  XCTAssertEqual("testKey", static_cast<std::string>(key));
+  XCTAssertTrue(key == js_context.CreatePropertyKey("testKey"));
+
+  XCTAssertFalse(js_object.HasProperty(key));
+  js_object.SetProperty(key, js_context.CreateString("PropertyKey"));
+  XCTAssertTrue(js_object.HasProperty(key));
+  XCTAssertTrue(js_object.HasProperty("testKey"));
+  XCTAssertEqual("PropertyKey", static_cast<std::string>(js_object.GetProperty(key)));
+
+  js_object.SetProperty("testKey", js_context.CreateNumber(42));
+  XCTAssertEqual(42, static_cast<std::int32_t>(js_object.GetProperty(key)));
+}
+
+TEST(DaisyContextTests, SetProperties) {
+  JSContextGroup js_context_group;
+  auto js_context = js_context_group.CreateContext();
+  auto js_object = js_context.CreateObject();
+  js_object.SetProperties({
+    { "first",  js_context.CreateNumber(1) },
+    { "second", js_context.CreateString("SetProperties") },
+    { "third",  js_context.CreateObject() }
+  });
+  XCTAssertEqual(1, static_cast<std::int32_t>(js_object.GetProperty("first")));
+  XCTAssertEqual("SetProperties", static_cast<std::string>(js_object.GetProperty("second")));
+  XCTAssertTrue(js_object.GetProperty("third").IsObject());
+
+  const auto key = js_context.CreatePropertyKey("first");
+  js_object.SetProperties({ { key, js_context.CreateNumber(2) } });
+  XCTAssertEqual(2, static_cast<std::int32_t>(js_object.GetProperty(key)));
+}
+
+TEST(DaisyContextTests, GetPropertyNames) {
+  JSContextGroup js_context_group;
+  auto js_context = js_context_group.CreateContext();
+  auto js_object = static_cast<JSObject>(js_context.JSEvaluateScript("var o = { a: 1, b: 'two' }; Object.defineProperty(o, 'hidden', { value: 3, enumerable: false }); Object.defineProperty(o, 'c', { get: function() { return 4; }, enumerable: true }); o;"));
+
+  auto names = js_object.GetPropertyNames();
+  std::sort(names.begin(), names.end());
+  XCTAssertEqual(3u, names.size());
+  XCTAssertEqual("a", names[0]);
+  XCTAssertEqual("b", names[1]);
+  XCTAssertEqual("c", names[2]);
+
+  XCTAssertTrue(js_context.CreateObject().GetPropertyNames().empty());
+}
+
+TEST(DaisyContextTests, GetPropertyNamesThrowingGetter) {
+  JSContextGroup js_context_group;
+  auto js_context = js_context_group.CreateContext();
+  auto js_object = static_cast<JSObject>(js_context.JSEvaluateScript("var getterCalls = 0; var o = { a: 1 }; Object.defineProperty(o, 'g', { get: function() { getterCalls++; throw new Error('getter'); }, enumerable: true }); o.b = 2; o;"));
+
+  const auto names = js_object.GetPropertyNames();
+  std::string joined;
+  for (const auto& name : names) {
+    joined += (joined.empty() ? "" : ",") + name;
+  }
+  XCTAssertEqual(static_cast<std::string>(js_context.JSEvaluateScript("Object.keys(o).join(',');")), joined);
+  XCTAssertEqual(3u, names.size());
+  XCTAssertEqual(0, static_cast<std::int32_t>(js_context.JSEvaluateScript("getterCalls;")));
+}
+
+TEST(DaisyContextTests, GetPropertyNamesSelfDeletingGetter) {
+  JSContextGroup js_context_group;
+  auto js_context = js_context_group.CreateContext();
+  auto js_object = static_cast<JSObject>(js_context.JSEvaluateScript("var o = { a: 1 }; Object.defineProperty(o, 'd', { get: function() { delete o.d; delete o.a; return 2; }, enumerable: true, configurable: true }); o.b = 3; o;"));
+
+  auto names = js_object.GetPropertyNames();
+  std::sort(names.begin(), names.end());
+  XCTAssertEqual(3u, names.size());
+  XCTAssertEqual("a", names[0]);
+  XCTAssertEqual("b", names[1]);
+  XCTAssertEqual("d", names[2]);
+
+  // Reading the values runs the getter, which deletes fields not yet reached.
+  const auto values = js_object.To<std::map<std::string, double>>();
+  XCTAssertEqual(3, static_cast<std::int32_t>(values.at("b")));
+  XCTAssertEqual(2, static_cast<std::int32_t>(values.at("d")));
+  XCTAssertEqual(2u, values.size());
+  XCTAssertEqual(1u, js_object.GetPropertyNames().size());
+}
+
+TEST(DaisyContextTests, CompiledScript) {
+  JSContextGroup js_context_group;
+  auto js_context = js_context_group.CreateContext();
+
+  auto js_script = js_context.CreateScript("var counter = (typeof counter === 'undefined') ? 1 : counter + 1; counter;");
+  XCTAssertTrue(js_script.IsCompiled());
+  XCTAssertEqual(1, static_cast<std::int32_t>(js_script.Run()));
+  XCTAssertEqual(2, static_cast<std::int32_t>(js_context.JSEvaluateScript(js_script)));
+
+  auto js_invalid = js_context.CreateScript("var = ;");
+  XCTAssertFalse(js_invalid.IsCompiled());
+  XCTAssertTrue(js_invalid.Run().IsUndefined());
+
+  js_context.set_script_cache_enabled(true);
+  for (std::uint32_t i = 0; i < 3; i++) {
+    XCTAssertEqual(3, static_cast<std::int32_t>(js_context.JSEvaluateScript("1 + 2;")));
+  }
+  XCTAssertEqual(1u, js_context.get_script_cache_misses());
+  XCTAssertEqual(2u, js_context.get_script_cache_hits());
+  js_context.set_script_cache_enabled(false);
+}
+
+TEST(DaisyContextTests, ScriptCacheEviction) {
+  // Every distinct source compiles to new code; without eviction freeing
+  // it, this would run a 64 KiB heap out of memory.
+  JSContextGroup js_context_group(64 * 1024);
+  auto js_context = js_context_group.CreateContext();
+  js_context.set_script_cache_enabled(true);
+  js_context.set_script_cache_capacity(4);
+
+  const auto js_evicted = js_context.CreateScript("(function () { return 40 + 2; })();");
+  for (std::uint32_t i = 0; i < 2000; i++) {
+    const auto source = "(function () { return 1 + 2; })();" + std::string(i, ' ');
+    XCTAssertEqual(3, static_cast<std::int32_t>(js_context.JSEvaluateScript(source)));
+    XCTAssertTrue(js_context.get_script_cache_size() <= 4u);
+  }
+  XCTAssertEqual(4u, js_context.get_script_cache_size());
+  XCTAssertEqual(42, static_cast<std::int32_t>(js_evicted.Run()));
+
+  js_context.set_script_cache_capacity(0);
+  XCTAssertEqual(0u, js_context.get_script_cache_size());
+  js_context.set_script_cache_capacity(64);
+  js_context.set_script_cache_enabled(false);
+}
+
+TEST(DaisyContextTests, Snapshot) {
+  const std::string snapshot_path = "DaisyContextTests_Snapshot.snapshot";
+  {
+    JSContextGroup js_context_group;
+    auto js_context = js_context_group.CreateContext();
+    const auto js_script = js_context.CreateScript("function greet(name) { return 'Hello, ' + name + '!'; } greet('snapshot') + ' ' + (1.5 * 2);");
+    const auto snapshot = js_script.CreateSnapshot();
+    XCTAssertFalse(snapshot.empty());
+
+    std::ofstream file(snapshot_path, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(snapshot.data()), snapshot.size());
+  }
+  {
+    JSContextGroup js_context_group;
+    auto js_context = js_context_group.CreateContext();
+    XCTAssertEqual("Hello, snapshot! 3", static_cast<std::string>(js_context.EvaluateSnapshot(snapshot_path)));
+
+    const std::uint8_t invalid[] = { 0, 1, 2, 3 };
+    XCTAssertTrue(js_context.EvaluateSnapshot(invalid, sizeof(invalid)).IsUndefined());
+  }
+  std::remove(snapshot_path.c_str());
+}
+
+TEST(DaisyContextTests, PrivateDataFinalizer) {
+  std::uint32_t finalized = 0;
+  {
+    JSContextGroup js_context_group;
+    auto js_context = js_context_group.CreateContext();
+    auto js_object = js_context.CreateObject();
+    js_object.SetPrivate(42, [&finalized](const std::uintptr_t& native_ptr) {
+      XCTAssertEqual(42u, native_ptr);
+      finalized++;
+    });
+    XCTAssertEqual(42u, js_object.GetPrivate());
+  }
+  XCTAssertEqual(1u, finalized);
+}
+
+TEST(DaisyContextTests, DeferredFinalization) {
+  std::uint32_t finalized = 0;
+  {
+    JSContextGroup js_context_group;
+    auto js_context = js_context_group.CreateContext();
+    js_context.set_deferred_finalization_enabled(true);
+    XCTAssertTrue(js_context.get_deferred_finalization_enabled());
+
+    for (std::uintptr_t i = 1; i <= 3; i++) {
+      auto js_object = js_context.CreateObject();
+      js_object.SetPrivate(i, [&finalized](const std::uintptr_t&) {
+        finalized++;
+      });
+    }
+    js_context.JSGarbageCollect();
+    XCTAssertEqual(0u, finalized);
+    XCTAssertEqual(3u, js_context.get_pending_finalization_count());
+
+    XCTAssertEqual(2u, js_context.DrainFinalizationQueue(2));
+    XCTAssertEqual(2u, finalized);
+    XCTAssertEqual(1u, js_context.get_pending_finalization_count());
+
+    auto js_object = js_context.CreateObject();
+    js_object.SetPrivate(4, [&finalized](const std::uintptr_t&) {
+      finalized++;
+    });
+  }
+  // The queue and the live object are finalized when the engine is cleaned up.
+  XCTAssertEqual(4u, finalized);
+}
+
+TEST(DaisyContextTests, HandleScope) {
+  JSContextGroup js_context_group;
+  auto js_context = js_context_group.CreateContext();
+
+  JSValue persistent = js_context.CreateUndefined();
+  {
+    JSHandleScope outer_scope;
+    JSValue kept = js_context.CreateUndefined();
+    {
+      JSHandleScope inner_scope;
+      auto js_object = js_context.CreateObject();
+      for (std::uint32_t i = 0; i < 100; i++) {
+        js_object.SetProperty("field" + std::to_string(i), js_context.CreateString("value" + std::to_string(i)));
+      }
+      const auto handle_count = inner_scope.size();
+      XCTAssertTrue(handle_count >= 101);
+
+      auto js_object_copy = js_object;
+      XCTAssertEqual(handle_count, inner_scope.size());
+
+      kept = inner_scope.Escape(js_object_copy);
+    }
+    XCTAssertEqual(1u, outer_scope.size());
+    XCTAssertEqual("value42", static_cast<std::string>(static_cast<JSObject>(kept).GetProperty("field42")));
+
+    persistent = outer_scope.Escape(kept);
+  }
+  XCTAssertEqual("value7", static_cast<std::string>(static_cast<JSObject>(persistent).GetProperty("field7")));
+}
+
+TEST(DaisyContextTests, CreateArray) {
+  JSContextGroup js_context_group;
+  auto js_context = js_context_group.CreateContext();
+  auto global_object = js_context.get_global_object();
+
+  std::vector<double> samples;
+  for (std::uint32_t i = 0; i < 1000; i++) {
+    samples.push_back(i * 0.5);
+  }
+  global_object.SetProperty("samples", js_context.CreateArray(samples));
+  XCTAssertTrue(static_cast<bool>(js_context.JSEvaluateScript("Array.isArray(samples) && samples.length === 1000 && samples[999] === 499.5;")));
+  XCTAssertEqual(249750.0, static_cast<double>(js_context.JSEvaluateScript("samples.reduce(function (a, b) { return a + b; }, 0);")));
+  XCTAssertTrue(samples == static_cast<JSObject>(global_object.GetProperty("samples")).ToVector<double>());
+
+  const std::vector<std::string> names { "a", "", "daisy" };
+  global_object.SetProperty("names", js_context.CreateArray(names));
+  XCTAssertEqual("a,,daisy", static_cast<std::string>(js_context.JSEvaluateScript("names.join();")));
+
+  const std::vector<bool> flags { true, false, true };
+  XCTAssertTrue(flags == js_context.CreateArray(flags).ToVector<bool>());
+
+  auto mixed = static_cast<JSObject>(js_context.JSEvaluateScript("var mixed = [1, 'two', {three: 3}, , true]; mixed;"));
+  const auto mixed_strings = mixed.ToVector<std::string>();
+  XCTAssertEqual(5u, mixed_strings.size());
+  XCTAssertEqual("1", mixed_strings[0]);
+  XCTAssertEqual("two", mixed_strings[1]);
+  XCTAssertEqual("undefined", mixed_strings[3]);
+  const auto mixed_values = mixed.ToVector<JSValue>();
+  XCTAssertTrue(mixed_values[2].IsObject());
+  XCTAssertTrue(mixed_values[3].IsUndefined());
+  XCTAssertEqual(3, static_cast<std::int32_t>(static_cast<JSObject>(mixed_values[2]).GetProperty("three")));
+
+  global_object.SetProperty("values", js_context.CreateArray(mixed_values));
+  XCTAssertTrue(static_cast<bool>(js_context.JSEvaluateScript("values[2] === mixed[2] && values.length === 5;")));
+
+  XCTAssertEqual(0u, js_context.CreateObject().ToVector<double>().size());
+  XCTAssertEqual(0u, js_context.CreateArray(std::vector<JSObject>()).ToVector<JSObject>().size());
+}
+
+TEST(DaisyContextTests, ToVectorHostileLength) {
+  JSContextGroup js_context_group(64 * 1024);
+  auto js_context = js_context_group.CreateContext();
+
+  // The heap could not hold more than heap size / 8 elements, so no more
+  // are read however large the length claims to be.
+  auto array_like = static_cast<JSObject>(js_context.JSEvaluateScript("({length: 4294967295, 0: 1.5});"));
+  const auto values = array_like.ToVector<double>();
+  XCTAssertTrue(values.size() <= 64u * 1024 / 8);
+  XCTAssertEqual(1.5, values[0]);
+
+  auto sparse = static_cast<JSObject>(js_context.JSEvaluateScript("var sparse = [1, 2]; sparse.length = 4294967295; sparse;"));
+  const auto sparse_values = sparse.ToVector<std::int32_t>();
+  XCTAssertTrue(sparse_values.size() <= 64u * 1024 / 8);
+  XCTAssertEqual(2, sparse_values[1]);
+
+}
+
+TEST(DaisyContextTests, ValueConverter) {
+  JSContextGroup js_context_group;
+  auto js_context = js_context_group.CreateContext();
+  auto global_object = js_context.get_global_object();
+
+  typedef std::map<std::string, std::vector<double>> Series;
+  typedef std::map<std::string, Series> Telemetry;
+  Telemetry telemetry;
+  telemetry["cpu"]["load"] = { 0.5, 0.75, 1.0 };
+  telemetry["cpu"]["temperature"] = { 41, 43 };
+  telemetry["memory"]["used"] = {};
+
+  global_object.SetProperty("telemetry", js_context.CreateValue(telemetry));
+  XCTAssertEqual(0.75, static_cast<double>(js_context.JSEvaluateScript("telemetry.cpu.load[1];")));
+  XCTAssertEqual("cpu,memory", static_cast<std::string>(js_context.JSEvaluateScript("Object.keys(telemetry).sort().join();")));
+  XCTAssertTrue(static_cast<bool>(js_context.JSEvaluateScript("Array.isArray(telemetry.memory.used) && telemetry.memory.used.length === 0;")));
+  XCTAssertTrue(telemetry == global_object.GetProperty("telemetry").To<Telemetry>());
+
+  const auto config = js_context.JSEvaluateScript("({ name: 'daisy', retries: 3, verbose: true });");
+  typedef std::unordered_map<std::string, std::string> Settings;
+  const auto settings = config.To<Settings>();
+  XCTAssertEqual(3u, settings.size());
+  XCTAssertEqual("daisy", settings.at("name"));
+  XCTAssertEqual("3", settings.at("retries"));
+  XCTAssertEqual("true", settings.at("verbose"));
+  typedef std::unordered_map<std::string, std::int32_t> Counts;
+  XCTAssertEqual(3, config.To<Counts>().at("retries"));
+
+  typedef std::tuple<std::string, int, bool, std::vector<std::string>> Record;
+  const Record record(std::string("x"), 42, true, std::vector<std::string> { "a", "b" });
+  global_object.SetProperty("record", js_context.CreateValue(record));
+  XCTAssertEqual("x,42,true,a,b", static_cast<std::string>(js_context.JSEvaluateScript("record.join();")));
+  XCTAssertTrue(record == global_object.GetProperty("record").To<Record>());
+
+  const auto partial = js_context.JSEvaluateScript("[1];").To<std::tuple<double, std::string>>();
+  XCTAssertEqual(1.0, std::get<0>(partial));
+  XCTAssertEqual("undefined", std::get<1>(partial));
+
+  std::map<std::string, JSObject> objects { { "global", global_object } };
+  XCTAssertTrue(static_cast<JSObject>(js_context.CreateValue(objects)).GetProperty("global").To<JSObject>().IsGlobalObject());
+
+  XCTAssertEqual(0u, js_context.CreateNumber(1.0).To<std::vector<double>>().size());
+  XCTAssertEqual(0u, js_context.CreateNull().To<Series>().size());
+
+  global_object.SetProperty("telemetry", js_context.CreateUndefined());
+  global_object.SetProperty("record", js_context.CreateUndefined());
+}
+
+TEST(DaisyContextTests, ValueConverterNestedStress) {
+  JSContextGroup js_context_group;
+  auto js_context = js_context_group.CreateContext();
+
+  // Creating inner arrays runs GC now and then while the outer array is
+  // being filled, which must not free the inner arrays already stored.
+  typedef std::vector<std::vector<double>> Rows;
+  const Rows rows(200, { 1.5 });
+  for (std::uint32_t i = 0; i < 3000; i++) {
+    const auto js_rows = js_context.CreateValue(rows);
+    XCTAssertTrue(rows == js_rows.To<Rows>());
+  }
+}
+
+TEST(DaisyContextTests, EventLoop) {
+  JSContextGroup js_context_group;
+  auto js_context = js_context_group.CreateContext();
+  JSEventLoop js_event_loop(js_context);
+
+  std::string order;
+  js_event_loop.SetTimeout([&](JSContext&) {
+    order += "b";
+    js_event_loop.QueueMicrotask([&](JSContext&) { order += "m"; });
+  }, std::chrono::milliseconds(10));
+  js_event_loop.SetTimeout([&](JSContext&) { order += "a"; }, std::chrono::milliseconds(0));
+  const auto cleared = js_event_loop.SetTimeout([&](JSContext&) { order += "x"; }, std::chrono::milliseconds(5));
+  js_event_loop.ClearTimer(cleared);
+  js_event_loop.ClearTimer(cleared);
+
+  std::uint32_t ticks = 0;
+  std::uint32_t interval = 0;
+  interval = js_event_loop.SetInterval([&](JSContext&) {
+    if (++ticks == 3) {
+      js_event_loop.ClearTimer(interval);
+    }
+  }, std::chrono::milliseconds(2));
+
+  js_event_loop.SetTimeout([&](JSContext&) { order += "c"; }, std::chrono::milliseconds(100));
+  js_event_loop.RunUntil(JSEventLoop::clock::now() + std::chrono::seconds(5));
+  XCTAssertFalse(js_event_loop.HasPendingTasks());
+  XCTAssertEqual("abmc", order);
+  XCTAssertEqual(3u, ticks);
+
+  js_event_loop.InstallGlobalFunctions();
+  js_context.JSEvaluateScript(
+    "var log = [];"
+    "setTimeout(function() { log.push('late'); }, 20);"
+    "setTimeout(function(suffix) { log.push('early' + suffix); queueMicrotask(function() { log.push('micro'); }); }, 5, '!');"
+    "var count = 0;"
+    "var id = setInterval(function() { if (++count == 3) { clearInterval(id); } }, 1);"
+    "clearTimeout(setTimeout(function() { log.push('cleared'); }, 1));");
+  js_event_loop.RunUntil(JSEventLoop::clock::now() + std::chrono::seconds(5));
+  XCTAssertEqual("early!,micro,late", static_cast<std::string>(js_context.JSEvaluateScript("log.join(',');")));
+  XCTAssertEqual(3, static_cast<std::int32_t>(js_context.JSEvaluateScript("count;")));
+}
+
+TEST(DaisyContextTests, ContextExecutor) {
+  JSContextGroup js_context_group;
+  auto js_context = js_context_group.CreateContext();
+  JSContextExecutor js_executor(js_context);
+
+  std::vector<std::future<double>> results(4 * 50);
+  std::vector<std::thread> producers;
+  for (std::uint32_t i = 0; i < 4; i++) {
+    producers.emplace_back([i, &js_executor, &results]() {
+      for (std::uint32_t j = 0; j < 50; j++) {
+        const auto n = i * 50 + j;
+        results[n] = js_executor.Post([n](JSContext& js_context) {
+          return static_cast<double>(js_context.JSEvaluateScript(std::to_string(n) + " * 2;"));
+        });
+      }
+    });
+  }
+
+  std::size_t run = 0;
+  while (run < results.size()) {
+    run += js_executor.RunPending(16);
+    std::this_thread::yield();
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  XCTAssertEqual(0u, js_executor.RunPending());
+
+  for (std::uint32_t n = 0; n < results.size(); n++) {
+    XCTAssertEqual(n * 2, results[n].get());
+  }
+
+  auto failed = js_executor.Post([](JSContext&) -> int {
+    throw std::runtime_error("failed");
+  });
+  XCTAssertEqual(1u, js_executor.RunPending());
+  ASSERT_THROW(failed.get(), std::runtime_error);
+
+  std::uint32_t dispatched = 0;
+  js_executor.Dispatch([&dispatched](JSContext& js_context) {
+    dispatched = static_cast<std::uint32_t>(js_context.JSEvaluateScript("1 + 2;"));
+  });
+  XCTAssertEqual(1u, js_executor.RunPending());
+  XCTAssertEqual(3u, dispatched);
+
+  auto dropped = js_executor.Post([](JSContext&) {});
+  {
+    JSContextExecutor other_executor(js_context);
+    dropped = other_executor.Post([](JSContext&) {});
+  }
+  ASSERT_THROW(dropped.get(), std::future_error);
+  XCTAssertEqual(1u, js_executor.RunPending());
+}
+
+#ifdef DAISY_ENABLE_CONTEXTS
+TEST(DaisyContextTests, ParallelContextGroups) {
+  std::vector<std::uint32_t> results(4);
+  std::vector<std::thread> threads;
+  for (std::uint32_t i = 0; i < results.size(); i++) {
+    threads.emplace_back([i, &results]() {
+      JSContextGroup js_context_group;
+      auto js_context = js_context_group.CreateContext();
+      auto global_object = js_context.get_global_object();
+      global_object.SetProperty("threadIndex", js_context.CreateNumber(i));
+      const auto js_result = js_context.JSEvaluateScript("var sum = 0; for (var n = 0; n < 1000; n++) { sum += threadIndex; } sum;");
+      results[i] = static_cast<std::uint32_t>(js_result);
+      global_object.SetProperty("threadIndex", js_context.CreateUndefined());
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (std::uint32_t i = 0; i < results.size(); i++) {
+    XCTAssertEqual(i * 1000, results[i]);
+  }
+}
+
+TEST(DaisyContextTests, SecondContextGroupOnThread) {
+  JSContextGroup js_context_group;
+  JSContextGroup js_context_group_copy(js_context_group);
+  auto js_context = js_context_group_copy.CreateContext();
+  XCTAssertEqual(2, static_cast<std::uint32_t>(js_context.JSEvaluateScript("1 + 1;")));
+  XCTAssertTrue(js_context_group.IsValid());
+  XCTAssertTrue(js_context_group_copy.IsValid());
+
+  {
+    JSContextGroup js_second_group(64 * 1024);
+    XCTAssertFalse(js_second_group.IsValid());
+    JSContextGroup js_second_group_copy(js_second_group);
+    XCTAssertFalse(js_second_group_copy.IsValid());
+  }
+
+  // The invalid groups neither touched nor released the engine.
+  XCTAssertEqual(4, static_cast<std::uint32_t>(js_context.JSEvaluateScript("2 + 2;")));
+}
+#endif
@@ -34,32 +34,81 @@ public:
 		JSExport<Widget>::AddFunctionProperty("testNull",      std::mem_fn(&Widget::testNull));
 		JSExport<Widget>::AddFunctionProperty("testUndefined", std::mem_fn(&Widget::testUndefined));
 		JSExport<Widget>::AddFunctionProperty("testCount",     std::mem_fn(&Widget::testCount));
+		JSExport<Widget>::AddFunctionProperty("testSum",       std::mem_fn(&Widget::testSum));
+		JSExport<Widget>::AddFunction("move",    &Widget::move);
+		JSExport<Widget>::AddFunction("greet",   &Widget::greet);
+		JSExport<Widget>::AddFunction("setFlag", &Widget::setFlag);
+		JSExport<Widget>::AddFunction("getFlag", &Widget::getFlag);
+		JSExport<Widget>::AddFunction("scale",   &Widget::scale);
+		JSExport<Widget>::AddFunction("toInt32",  &Widget::toInt32);
+		JSExport<Widget>::AddFunction("toUint32", &Widget::toUint32);
 	}
 
-	JSValue testString(const std::vector<JSValue>& arguments, JSObject& this_object) {
+	JSValue testString(const JSArguments& arguments, JSObject& this_object) {
 		return this_object.get_context().CreateString("Widget test OK");
 	}
 
-	JSValue testBoolean(const std::vector<JSValue>& arguments, JSObject& this_object) {
+	JSValue testBoolean(const JSArguments& arguments, JSObject& this_object) {
 		return this_object.get_context().CreateBoolean(true);
 	}
 
-	JSValue testNumber(const std::vector<JSValue>& arguments, JSObject& this_object) {
+	JSValue testNumber(const JSArguments& arguments, JSObject& this_object) {
 		return this_object.get_context().CreateNumber(1234);
 	}
 
-	JSValue testNull(const std::vector<JSValue>& arguments, JSObject& this_object) {
+	JSValue testNull(const JSArguments& arguments, JSObject& this_object) {
 		return this_object.get_context().CreateNull();
 	}
 
-	JSValue testUndefined(const std::vector<JSValue>& arguments, JSObject& this_object) {
+	JSValue testUndefined(const JSArguments& arguments, JSObject& this_object) {
 		return this_object.get_context().CreateUndefined();
 	}
 
-	JSValue testCount(const std::vector<JSValue>& arguments, JSObject& this_object) {
+	JSValue testCount(const JSArguments& arguments, JSObject& this_object) {
 		return this_object.get_context().CreateNumber(count__);
 	}
 
+	JSValue testSum(const JSArguments& arguments, JSObject& this_object) {
+		double sum = 0;
+		for (const auto argument : arguments) {
+			sum += static_cast<double>(argument);
+		}
+		return this_object.get_context().CreateNumber(sum);
+	}
+
+	double move(double dx, std::int32_t dy) {
+		position__ += dx + dy;
+		return position__;
+	}
+
+	std::string greet(const std::string& name) const {
+		return "Hello, " + name;
+	}
+
+	void setFlag(bool flag) {
+		flag__ = flag;
+	}
+
+	bool getFlag() const {
+		return flag__;
+	}
+
+	std::vector<double> scale(const std::vector<double>& values, double factor) const {
+		std::vector<double> result;
+		for (const auto value : values) {
+			result.push_back(value * factor);
+		}
+		return result;
+	}
+
+	std::int32_t toInt32(std::int32_t value) const {
+		return value;
+	}
+
+	std::uint32_t toUint32(std::uint32_t value) const {
+		return value;
+	}
+
 	virtual void postInitialize(JSObject& this_object) override {
 		this_object.SetProperty("is_initialized", get_context().CreateBoolean(true));
 	}
@@ -79,6 +128,8 @@ public:
 
 private:
 	std::uint32_t count__ { 0 };
+	double position__ { 0 };
+	bool flag__ { false };
 };
 
 class ChildWidget : public Widget, public JSExport<ChildWidget> {
@@ -90,7 +141,7 @@ public:
 	virtual ~ChildWidget() DAISY_NOEXCEPT {
 	}
 
-	JSValue testChildMethod(const std::vector<JSValue>& arguments, JSObject& this_object) {
+	JSValue testChildMethod(const JSArguments& arguments, JSObject& this_object) {
 		return this_object.get_context().CreateString("string from child widget");
 	}
 
@@ -101,6 +152,39 @@ public:
 	}	
 };
 
+class PooledWidget : public JSExportObject, public JSExport<PooledWidget> {
+public:
+	PooledWidget(const JSContext& js_context) DAISY_NOEXCEPT
+		: JSExportObject(js_context) {
+		++constructed;
+	}
+
+	virtual ~PooledWidget() DAISY_NOEXCEPT {
+		++destructed;
+	}
+
+	static void JSExportInitialize() {
+		JSExport<PooledWidget>::AddFunction("getValue", &PooledWidget::getValue);
+	}
+
+	double getValue() const {
+		return 42;
+	}
+
+	static std::size_t constructed;
+	static std::size_t destructed;
+};
+
+std::size_t PooledWidget::constructed = 0;
+std::size_t PooledWidget::destructed  = 0;
+
+namespace Daisy {
+	template<>
+	struct JSExportAllocator<PooledWidget> {
+		typedef JSSlabAllocator<PooledWidget> type;
+	};
+}
+
 TEST(DaisyExportTests, FunctionCallback_String) {
 	JSContextGroup js_context_group;
 	auto js_context = js_context_group.CreateContext();
@@ -184,6 +268,89 @@ TEST(DaisyExportTests, FunctionCallback_Undefined) {
 	XCTAssertTrue(test_result.IsUndefined());
 }
 
+TEST(DaisyExportTests, FunctionCallback_Arguments) {
+	JSContextGroup js_context_group;
+	auto js_context = js_context_group.CreateContext();
+
+	auto widget = js_context.CreateObject(JSExport<Widget>::Class());
+	auto test_func = static_cast<JSObject>(widget.GetProperty("testSum"));
+	XCTAssertTrue(test_func.IsFunction());
+
+	std::vector<JSValue> arguments;
+	for (std::uint32_t i = 1; i <= 10; i++) {
+		arguments.push_back(js_context.CreateNumber(i));
+	}
+	XCTAssertEqual(55, static_cast<std::uint32_t>(test_func(arguments, widget)));
+	arguments.erase(arguments.begin() + 3, arguments.end());
+	XCTAssertEqual(6, static_cast<std::uint32_t>(test_func(arguments, widget)));
+	XCTAssertEqual(0, static_cast<std::uint32_t>(test_func(widget)));
+}
+
+TEST(DaisyExportTests, FunctionCallback_Typed) {
+	JSContextGroup js_context_group;
+	auto js_context = js_context_group.CreateContext();
+
+	auto widget = js_context.CreateObject(JSExport<Widget>::Class());
+	js_context.get_global_object().SetProperty("widget", widget);
+
+	XCTAssertEqual(3.5, static_cast<double>(js_context.JSEvaluateScript("widget.move(1.5, 2);")));
+	XCTAssertEqual(4.0, static_cast<double>(js_context.JSEvaluateScript("widget.move(0.5, 0.9);")));
+	XCTAssertEqual("Hello, Daisy", static_cast<std::string>(js_context.JSEvaluateScript("widget.greet('Daisy');")));
+	XCTAssertTrue(js_context.JSEvaluateScript("widget.setFlag(true);").IsUndefined());
+	XCTAssertTrue(static_cast<bool>(js_context.JSEvaluateScript("widget.getFlag();")));
+	XCTAssertEqual("2,4,7", static_cast<std::string>(js_context.JSEvaluateScript("widget.scale([1, 2, 3.5], 2).join();")));
+
+	// too few arguments: the missing ones are passed as undefined
+	XCTAssertEqual(5.0, static_cast<double>(js_context.JSEvaluateScript("widget.move(1);")));
+	XCTAssertEqual(5.0, static_cast<double>(js_context.JSEvaluateScript("widget.move();")));
+	XCTAssertEqual("Hello, undefined", static_cast<std::string>(js_context.JSEvaluateScript("widget.greet();")));
+	XCTAssertEqual("0,0", static_cast<std::string>(js_context.JSEvaluateScript("widget.scale([1, 2]).join();")));
+	XCTAssertEqual(6.0, static_cast<double>(js_context.JSEvaluateScript("widget.move(1, 0, 'extra');")));
+
+	// numbers are converted to integers like ToInt32 and ToUint32
+	XCTAssertEqual(-1.0, static_cast<double>(js_context.JSEvaluateScript("widget.toInt32(-1);")));
+	XCTAssertEqual(-2.0, static_cast<double>(js_context.JSEvaluateScript("widget.toInt32(-2.75);")));
+	XCTAssertEqual(-1294967296.0, static_cast<double>(js_context.JSEvaluateScript("widget.toInt32(3e9);")));
+	XCTAssertEqual(0.0, static_cast<double>(js_context.JSEvaluateScript("widget.toInt32(NaN);")));
+	XCTAssertEqual(0.0, static_cast<double>(js_context.JSEvaluateScript("widget.toInt32(-Infinity);")));
+	XCTAssertEqual(4294966784.0, static_cast<double>(js_context.JSEvaluateScript("widget.toUint32(-512);")));
+	XCTAssertEqual(3000000000.0, static_cast<double>(js_context.JSEvaluateScript("widget.toUint32(3e9);")));
+	XCTAssertEqual(0.0, static_cast<double>(js_context.JSEvaluateScript("widget.toUint32(NaN);")));
+	XCTAssertEqual(0.0, static_cast<double>(js_context.JSEvaluateScript("widget.toUint32(Infinity);")));
+	XCTAssertEqual(512.0, static_cast<double>(js_context.JSEvaluateScript("widget.toUint32(4294967808);")));
+	XCTAssertEqual(4294967295u, JSValueConverter<std::uint32_t>::FromApiValue(js_context, JSValueConverter<double>::ToApiValue(-1)));
+	XCTAssertEqual(-1, JSValueConverter<std::int8_t>::FromApiValue(js_context, JSValueConverter<double>::ToApiValue(255)));
+
+	// without a native peer the method is not called
+	XCTAssertTrue(js_context.JSEvaluateScript("widget.move.call({}, 1, 1);").IsUndefined());
+	XCTAssertEqual(6.0, static_cast<double>(js_context.JSEvaluateScript("widget.move(0, 0);")));
+
+	js_context.get_global_object().SetProperty("widget", js_context.CreateUndefined());
+}
+
+TEST(DaisyExportTests, SlabAllocator) {
+	JSSlabAllocator<PooledWidget> allocator;
+	const auto first = allocator.allocate(1);
+	allocator.deallocate(first, 1);
+	const auto second = allocator.allocate(1);
+	XCTAssertEqual(first, second);
+	allocator.deallocate(second, 1);
+
+	PooledWidget::constructed = 0;
+	PooledWidget::destructed  = 0;
+	{
+		JSContextGroup js_context_group;
+		auto js_context = js_context_group.CreateContext();
+		for (std::uint32_t i = 0; i < 100; i++) {
+			auto widget = js_context.CreateObject(JSExport<PooledWidget>::Class());
+			auto get_value = static_cast<JSObject>(widget.GetProperty("getValue"));
+			XCTAssertEqual(42, static_cast<std::int32_t>(get_value(widget)));
+		}
+		XCTAssertEqual(100u, PooledWidget::constructed);
+	}
+	XCTAssertEqual(PooledWidget::constructed, PooledWidget::destructed);
+}
+
 TEST(DaisyExportTests, GetPrivate) {
 	JSContextGroup js_context_group;
 	auto js_context = js_context_group.CreateContext();
@@ -239,6 +406,25 @@ TEST(DaisyExportTests, JSExport_Constructor) {
 	XCTAssertTrue(static_cast<bool>(widget.GetProperty("is_constructed")));
 }
 
+TEST(DaisyExportTests, SharedPrototype) {
+	JSContextGroup js_context_group;
+	auto js_context = js_context_group.CreateContext();
+	auto global_object = js_context.get_global_object();
+
+	global_object.SetProperty("first",  js_context.CreateObject(JSExport<Widget>::Class()));
+	global_object.SetProperty("second", js_context.CreateObject(JSExport<Widget>::Class()));
+
+	XCTAssertTrue(static_cast<bool>(js_context.JSEvaluateScript("first.testString === second.testString;")));
+	XCTAssertTrue(static_cast<bool>(js_context.JSEvaluateScript("first.prototype === second.prototype;")));
+	XCTAssertTrue(static_cast<bool>(js_context.JSEvaluateScript("first.testString === first.prototype.testString;")));
+	XCTAssertTrue(static_cast<bool>(js_context.JSEvaluateScript("var w = new first(); w.testString === first.testString;")));
+	XCTAssertEqual("Widget test OK", static_cast<std::string>(js_context.JSEvaluateScript("w.testString();")));
+
+	global_object.SetProperty("first",  js_context.CreateUndefined());
+	global_object.SetProperty("second", js_context.CreateUndefined());
+	global_object.SetProperty("w",      js_context.CreateUndefined());
+}
+
 TEST(DaisyExportTests, PrototypeChain) {
 	JSContextGroup js_context_group;
 	auto js_context = js_context_group.CreateContext();
@@ -11,9 +11,75 @@
 #define XCTAssertFalse    ASSERT_FALSE
 
 #include "jerry.h"
+#include <cstring>
 
 TEST(JerryCoreTests, CoreInit) {
   jerry_init (JERRY_FLAG_EMPTY);
   jerry_cleanup();
   XCTAssertTrue(true);
 }
+
+TEST(JerryCoreTests, CoreInitWithHeapSize) {
+  // 0 is the default size; sizes over the build's maximum are reduced to it.
+  const size_t heap_sizes[] = { 64 * 1024, 0, static_cast<size_t>(-1) / 2 };
+  const jerry_api_char_t source[] = "var a = []; for (var i = 0; i < 100; i++) { a.push ('item' + i); }";
+  for (const auto heap_size : heap_sizes) {
+    jerry_init_with_heap_size (JERRY_FLAG_EMPTY, heap_size);
+    XCTAssertTrue(jerry_parse (source, sizeof (source) - 1));
+    XCTAssertEqual(JERRY_COMPLETION_CODE_OK, jerry_run ());
+    jerry_cleanup();
+  }
+}
+
+TEST(JerryCoreTests, AllocationLargerThanHeap) {
+  // A string larger than the whole heap is refused as out of memory.
+  const jerry_api_char_t source[] = "var s = 'x'; for (var i = 0; i < 17; i++) { s += s; }";
+  ASSERT_EXIT({
+    jerry_init_with_heap_size (JERRY_FLAG_EMPTY, 64 * 1024);
+    jerry_parse (source, sizeof (source) - 1);
+    jerry_run ();
+  }, ::testing::ExitedWithCode(ERR_OUT_OF_MEMORY), "");
+}
+
+TEST(JerryCoreTests, SnapshotCorruptedHeader) {
+  jerry_init (JERRY_FLAG_EMPTY);
+  const jerry_api_char_t source[] = "var s = 'snapshot'; s + 1.5;";
+  uint8_t snapshot[1024];
+  const size_t snapshot_size = jerry_parse_and_save_snapshot (source, sizeof (source) - 1, snapshot, sizeof (snapshot));
+  XCTAssertTrue(snapshot_size > 0);
+
+  // literals_count follows magic, version, instr_size, number_size,
+  // instrs_count, blocks_count and buckets_count in the header.
+  const size_t literals_count_offset = 24;
+  const uint32_t literals_count = 0x7fffffffu;
+  uint8_t corrupted[sizeof (snapshot)];
+  memcpy (corrupted, snapshot, snapshot_size);
+  memcpy (corrupted + literals_count_offset, &literals_count, sizeof (literals_count));
+
+  jerry_api_value_t result;
+  XCTAssertEqual(JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_FORMAT, jerry_exec_snapshot (corrupted, snapshot_size, &result));
+  XCTAssertEqual(JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_FORMAT, jerry_exec_snapshot (snapshot, snapshot_size - 1, &result));
+
+  XCTAssertEqual(JERRY_COMPLETION_CODE_OK, jerry_exec_snapshot (snapshot, snapshot_size, &result));
+  XCTAssertEqual(JERRY_API_DATA_TYPE_STRING, result.type);
+  jerry_api_release_value (&result);
+  jerry_cleanup();
+}
+
+TEST(JerryCoreTests, SnapshotExecFreesBytecode) {
+  // The byte-code copied from the snapshot is freed after every run, so a
+  // small heap does not run out over many runs.
+  jerry_init_with_heap_size (JERRY_FLAG_EMPTY, 64 * 1024);
+  const jerry_api_char_t source[] = "var n = 0; for (var i = 0; i < 10; i++) { n += (function (k) { return k * 2; }) (i); } n;";
+  uint8_t snapshot[4096];
+  const size_t snapshot_size = jerry_parse_and_save_snapshot (source, sizeof (source) - 1, snapshot, sizeof (snapshot));
+  XCTAssertTrue(snapshot_size > 0);
+
+  for (int i = 0; i < 2000; i++) {
+    jerry_api_value_t result;
+    XCTAssertEqual(JERRY_COMPLETION_CODE_OK, jerry_exec_snapshot (snapshot, snapshot_size, &result));
+    const double n = (result.type == JERRY_API_DATA_TYPE_FLOAT32) ? result.v_float32 : result.v_float64;
+    XCTAssertEqual(90.0, n);
+  }
+  jerry_cleanup();
+}